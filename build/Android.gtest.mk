@@ -95,6 +95,7 @@ RUNTIME_GTEST_COMMON_SRC_FILES := \
   runtime/exception_test.cc \
   runtime/gc/accounting/card_table_test.cc \
   runtime/gc/accounting/space_bitmap_test.cc \
+  runtime/gc/gc_benchmark_test.cc \
   runtime/gc/heap_test.cc \
   runtime/gc/space/dlmalloc_space_base_test.cc \
   runtime/gc/space/dlmalloc_space_static_test.cc \
@@ -117,6 +118,7 @@ RUNTIME_GTEST_COMMON_SRC_FILES := \
   runtime/monitor_test.cc \
   runtime/parsed_options_test.cc \
   runtime/reference_table_test.cc \
+  runtime/thread_list_test.cc \
   runtime/thread_pool_test.cc \
   runtime/transaction_test.cc \
   runtime/utils_test.cc \
@@ -36,7 +36,11 @@ class BufferedOutputStream : public OutputStream {
   virtual off_t Seek(off_t offset, Whence whence);
 
  private:
-  static const size_t kBufferSize = 8 * KB;
+  // Large enough that oat writing issues one write syscall per 128K instead of one per 8K of
+  // output; writes larger than this bypass the buffer entirely. The kernel page cache already
+  // provides write-behind past this point, so there is no benefit to buffering more (or to
+  // O_DIRECT, which would only disable that write-behind and make us reimplement it).
+  static const size_t kBufferSize = 128 * KB;
 
   bool Flush();
 
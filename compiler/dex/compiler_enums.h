@@ -145,6 +145,14 @@ enum ExtendedMIROpcode {
   //
   // At this point, only two operand instructions are supported.  Three operand instructions
   // could be supported by using a bit in TypeSize and arg[0] where needed.
+  //
+  // Note that no in-tree pass generates these opcodes yet: they exist for backends and
+  // out-of-tree loop vectorizers, and only the x86 backend lowers them (to SSE). An in-tree
+  // vectorizer that recognizes unit-stride counted loops over primitive arrays and rewrites
+  // the loop body to packed opcodes with a scalar epilogue needs (a) dependence and alias
+  // analysis that is sound across the loop safepoint and potential ArrayIndexOutOfBounds
+  // throws mid-vector, and (b) on ARM, NEON lowerings in the Quick LIR and encoder, which
+  // currently stop at scalar VFP. Until both exist, array loops stay scalar on ARM.
 
   // @brief MIR to move constant data to a vector register
   // vA: destination
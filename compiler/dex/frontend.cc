@@ -41,6 +41,14 @@ namespace art {
  * can happen at safepoint: GC, profiling, debugging, deoptimization, etc. Once the
  * interaction is better defined (like some safepoints can only be GC) and compiler can
  * also provide better deoptimization points, this can be enabled.
+ *
+ * The same contract blocks a loop-invariant code motion pass. Hoisting an iget, sget or
+ * array-length load out of a loop body moves the load across the loop's safepoint, where a
+ * debugger or deoptimization may observe or replace the value, and hoisting the access above
+ * its null check changes which iteration throws. Until safepoints are classified and the
+ * compiler can emit deoptimization points, LICM has the same status as the disabled
+ * load-store elimination below; the loop information in ssa_transformation is not the
+ * missing piece.
  */
 static uint32_t kCompilerOptimizerDisableFlags = 0 |  // Disable specific optimizations
   (1 << kLoadStoreElimination) |
@@ -197,17 +205,23 @@ static CompiledMethod* CompileMethod(CompilerDriver& driver,
     return nullptr;
   }
 
-  /* Create the pass driver and launch it */
-  PassDriverMEOpts pass_driver(&cu);
-  pass_driver.Launch();
-
-  /* For non-leaf methods check if we should skip compilation when the profiler is enabled. */
+  /*
+   * For non-leaf methods check if we should skip compilation when the profiler is enabled.
+   * Done before the optimization passes: a profile-rejected method falls back to the
+   * interpreter, so the pass pipeline is the bulk of what skipping is meant to save. SSA
+   * conversion has not run yet, so leafness is read from the raw MIR rather than
+   * METHOD_IS_LEAF.
+   */
   if (cu.compiler_driver->ProfilePresent()
-      && !cu.mir_graph->MethodIsLeaf()
+      && cu.mir_graph->HasInvokesPreSSA()
       && cu.mir_graph->SkipCompilationByName(PrettyMethod(method_idx, dex_file))) {
     return nullptr;
   }
 
+  /* Create the pass driver and launch it */
+  PassDriverMEOpts pass_driver(&cu);
+  pass_driver.Launch();
+
   if (cu.enable_debug & (1 << kDebugDumpCheckStats)) {
     cu.mir_graph->DumpCheckStats();
   }
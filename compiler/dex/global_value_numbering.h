@@ -211,6 +211,12 @@ class GlobalValueNumbering {
   // The number of BBs that we need to process grows exponentially with the number
   // of nested loops. Don't allow excessive processing for too many nested loops or
   // otherwise expensive methods.
+  // Note that this is a convergence budget, not a method size cap: it scales with the number of
+  // reachable blocks, so a 500-block method gets 10000 block visits before GVN declares itself
+  // bad and drops all modifications. The value maps are already sparse hashed/sorted tables on
+  // the scoped arena, so big methods that hit the budget are spending it on loop re-iteration,
+  // not on representation: raising the factor, not restructuring, is the lever if a hot method
+  // legitimately needs more iterations to converge.
   static constexpr uint32_t kMaxBbsToProcessMultiplyFactor = 20u;
 
   uint32_t bbs_processed_;
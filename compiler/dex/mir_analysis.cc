@@ -1081,6 +1081,20 @@ bool MIRGraph::SkipCompilation(std::string* skip_message) {
     return true;
   }
 
+  /*
+   * Filter 0: Predict compile cost from the shape of the graph. The dataflow and register
+   * allocation passes scale with blocks times vregs, so an obfuscated method with thousands of
+   * blocks over a wide frame can take tens of seconds while staying under the pure
+   * instruction-count thresholds below. The budget derives from the huge-method threshold so
+   * the existing --huge-method-max flag tunes it.
+   */
+  const size_t compile_cost = static_cast<size_t>(num_blocks_) * GetNumOfCodeVRs();
+  if (compile_cost >= compiler_options.GetHugeMethodThreshold() * 64) {
+    *skip_message = "Pathological method: " + std::to_string(num_blocks_) + " blocks * " +
+                    std::to_string(GetNumOfCodeVRs()) + " vregs";
+    return true;
+  }
+
   // Set up compilation cutoffs based on current filter mode.
   size_t small_cutoff = 0;
   size_t default_cutoff = 0;
@@ -1358,4 +1372,17 @@ bool MIRGraph::SkipCompilationByName(const std::string& methodname) {
   return cu_->compiler_driver->SkipCompilation(methodname);
 }
 
+bool MIRGraph::HasInvokesPreSSA() {
+  AllNodesIterator iter(this);
+  for (BasicBlock* bb = iter.Next(); bb != NULL; bb = iter.Next()) {
+    for (MIR* mir = bb->first_mir_insn; mir != NULL; mir = mir->next) {
+      if (!MIR::DecodedInstruction::IsPseudoMirOp(mir->dalvikInsn.opcode) &&
+          (mir->dalvikInsn.FlagsOf() & Instruction::kInvoke) != 0) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 }  // namespace art
@@ -1398,9 +1398,13 @@ void MIRGraph::CountUses(struct BasicBlock* bb) {
   if (bb->block_type != kDalvikByteCode) {
     return;
   }
-  // Each level of nesting adds *100 to count, up to 3 levels deep.
+  // Each level of nesting multiplies the use weight by 16, up to 3 levels deep. The weight has
+  // to grow geometrically rather than linearly with depth: trip counts of nested loops compound,
+  // and promotion compares these totals across the whole method, so a vreg with a few uses in an
+  // inner loop must outweigh one with many uses in straight-line code or the inner loop ends up
+  // with the spill/reload pair while a cold vreg sits in a callee-save register.
   uint32_t depth = std::min(3U, static_cast<uint32_t>(bb->nesting_depth));
-  uint32_t weight = std::max(1U, depth * 100);
+  uint32_t weight = 1U << (4 * depth);
   for (MIR* mir = bb->first_mir_insn; (mir != NULL); mir = mir->next) {
     if (mir->ssa_rep == NULL) {
       continue;
@@ -42,6 +42,13 @@ void MirIFieldLoweringInfo::Resolve(CompilerDriver* compiler_driver,
 
   // We're going to resolve fields and check access in a tight loop. It's better to hold
   // the lock and needed references once than re-acquiring them again and again.
+  //
+  // Note that repeated lowering of the same field across the methods of a class is already
+  // cheap: the indexes arrive deduplicated per method, ResolveField() is a dex cache hit after
+  // the first method resolved the field, and only the referrer-dependent fast-path flags are
+  // recomputed, which is a few flag tests and pointer compares against the referrer class. A
+  // per-class-def memoization table in CompilerDriver would have to be locked against the
+  // sibling methods compiling concurrently, costing more than the recompute it would save.
   ScopedObjectAccess soa(Thread::Current());
   StackHandleScope<3> hs(soa.Self());
   Handle<mirror::DexCache> dex_cache(hs.NewHandle(compiler_driver->GetDexCache(mUnit)));
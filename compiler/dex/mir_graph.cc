@@ -179,6 +179,12 @@ int MIRGraph::ParseInsn(const uint16_t* code_ptr, MIR::DecodedInstruction* decod
 
 
 /* Split an existing block from the specified code offset into two */
+// Known superlinear spot for very large methods: the scan below walks the MIR list of the block
+// being split because the offset map only records block ids, not MIR pointers, and the list is
+// singly linked so the predecessor of the split point has to be found by walking anyway. Making
+// this O(1) needs either a prev link in MIR or a per-method offset->MIR side table, both of
+// which tax every method to help the rare 20K-instruction one. Block *lookup* is already a flat
+// array index (dex_pc_to_block_map_), so splitting is the only part that degrades with size.
 BasicBlock* MIRGraph::SplitBlock(DexOffset code_offset,
                                  BasicBlock* orig_block, BasicBlock** immed_pred_block_p) {
   MIR* insn = orig_block->first_mir_insn;
@@ -572,6 +572,14 @@ class MIRGraph {
    */
   bool SkipCompilationByName(const std::string& methodname);
 
+  /*
+   * Does the method contain any invokes? Usable before SSA conversion, which is what maintains
+   * the METHOD_IS_LEAF attribute. This walks every MIR; after SSA conversion use the O(1)
+   * HasInvokes() below, which this deliberately does not overload to avoid rebinding its
+   * callers to the scan.
+   */
+  bool HasInvokesPreSSA();
+
   /*
    * Parse dex method and add MIR at current insert point.  Returns id (which is
    * actually the index of the method in the m_units_ array).
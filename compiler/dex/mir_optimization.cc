@@ -27,6 +27,15 @@
 
 namespace art {
 
+// A note on escape analysis, which keeps getting proposed for this file: stack-allocating
+// non-escaping objects is not just a compiler feature here, it breaks a runtime invariant.
+// Every collector in this tree assumes mirror::Object* values point into managed spaces --
+// space membership tests, card marking for reference fields, identity hashcode and monitor
+// inflation, and the moving collectors (semi-space, homogeneous compaction) all misbehave on
+// an object living in a quick frame. Scalar replacement that never materializes the object
+// avoids those problems, but it needs a sound intraprocedural alias analysis over SSA that
+// the MIR layer does not have, and half-built escape reasoning miscompiles quietly. Until a
+// collector contract exists for off-heap objects, new-instance goes to the heap.
 static unsigned int Predecessors(BasicBlock* bb) {
   return bb->predecessors->Size();
 }
@@ -23,6 +23,15 @@
 
 namespace art {
 
+// These passes rebuild predecessors, DFS orders, domination and SSA unconditionally rather than
+// tracking which earlier pass dirtied what. That is a deliberate trade: an analysis-preservation
+// scheme is only as good as its invalidation coverage, and MIRGraph is mutated directly from
+// inside many optimization workers -- one missed invalidation site means a pass runs over stale
+// dominators and miscompiles silently. Until mutation is funneled through a narrow interface
+// that can flip dirty bits reliably, recomputing is the safe default. Per-pass cost is already
+// visible: RunPass opens a TimingLogger split named after each pass (see dex2oat's timing dump),
+// and Pass::Gate is the hook for skipping work a pass can prove unnecessary.
+
 /**
  * @class InitializeData
  * @brief There is some data that needs to be initialized before performing
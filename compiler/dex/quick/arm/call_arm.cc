@@ -323,6 +323,14 @@ void ArmMir2Lir::GenMoveException(RegLocation rl_dest) {
 
 /*
  * Mark garbage collection card. Skip if the value we're storing is null.
+ *
+ * Null stores are already elided twice over: GenIPut/GenSPut skip the call entirely for
+ * constant nulls, and the branch below handles runtime nulls. The other commonly proposed
+ * elision - no card for stores into an object freshly allocated in the same block - is sound
+ * only while no safepoint can intervene between the allocation and the store, a property the
+ * MIR layer would have to prove and every later code-motion change would have to preserve.
+ * Given a dirty card costs three instructions and a byte store while a missed card is a lost
+ * object under the sticky collector, that proof obligation buys too little to carry.
  */
 void ArmMir2Lir::MarkGCCard(RegStorage val_reg, RegStorage tgt_addr_reg) {
   RegStorage reg_card_base = AllocTemp();
@@ -355,6 +363,10 @@ void ArmMir2Lir::GenEntrySequence(RegLocation* ArgLocs, RegLocation rl_method) {
    * a leaf *and* our frame size < fudge factor.
    */
   bool skip_overflow_check = mir_graph_->MethodIsLeaf() && !FrameNeedsStackCheck(frame_size_, kArm);
+  // Policy summary: small leaf methods get no check at all, ordinary frames get the implicit
+  // guard-page probe below (the default on arm - see Runtime::Init's implicit_so_checks_), and
+  // only frames bigger than the reserved region fall back to an explicit limit compare, since
+  // a probe at [sp - overflowsize] cannot vouch for a frame that extends past the redzone.
   NewLIR0(kPseudoMethodEntry);
   const size_t kStackOverflowReservedUsableBytes = GetStackOverflowReservedBytes(kArm);
   bool large_frame = (static_cast<size_t>(frame_size_) > kStackOverflowReservedUsableBytes);
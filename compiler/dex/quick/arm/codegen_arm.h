@@ -107,6 +107,7 @@ class ArmMir2Lir FINAL : public Mir2Lir {
     bool GenInlinedCas(CallInfo* info, bool is_long, bool is_object);
     bool GenInlinedMinMax(CallInfo* info, bool is_min, bool is_long);
     bool GenInlinedSqrt(CallInfo* info);
+    bool GenInlinedNumberOfLeadingZeros(CallInfo* info, OpSize size) OVERRIDE;
     bool GenInlinedPeek(CallInfo* info, OpSize size);
     bool GenInlinedPoke(CallInfo* info, OpSize size);
     bool GenInlinedArrayCopyCharArray(CallInfo* info) OVERRIDE;
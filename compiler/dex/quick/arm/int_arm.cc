@@ -749,6 +749,34 @@ bool ArmMir2Lir::GenInlinedMinMax(CallInfo* info, bool is_min, bool is_long) {
   return true;
 }
 
+bool ArmMir2Lir::GenInlinedNumberOfLeadingZeros(CallInfo* info, OpSize size) {
+  RegLocation rl_src_i = info->args[0];
+  RegLocation rl_dest = InlineTarget(info);  // int result, also for the long input.
+  if (size == k64) {
+    RegLocation rl_i = LoadValueWide(rl_src_i, kCoreReg);
+    RegLocation rl_result = EvalLoc(rl_dest, kCoreReg, true);
+    // clz(x) = (hi != 0) ? clz(hi) : 32 + clz(lo).
+    RegStorage t_reg = AllocTemp();
+    // The result register may alias one of the source halves (cf. GenInlinedPeek), so consume
+    // both source halves before the clz that writes the result. CLZ does not touch the flags,
+    // so it is safe between the cmp and the IT block.
+    NewLIR3(kThumb2ClzRR, t_reg.GetReg(), rl_i.reg.GetLowReg(), rl_i.reg.GetLowReg());
+    OpRegImm(kOpCmp, rl_i.reg.GetHigh(), 0);
+    NewLIR3(kThumb2ClzRR, rl_result.reg.GetReg(), rl_i.reg.GetHighReg(), rl_i.reg.GetHighReg());
+    LIR* it = OpIT(kCondEq, "");
+    OpRegReg(kOpAdd, rl_result.reg, t_reg);
+    OpEndIT(it);
+    FreeTemp(t_reg);
+    StoreValue(rl_dest, rl_result);
+  } else {
+    RegLocation rl_i = LoadValue(rl_src_i, kCoreReg);
+    RegLocation rl_result = EvalLoc(rl_dest, kCoreReg, true);
+    NewLIR3(kThumb2ClzRR, rl_result.reg.GetReg(), rl_i.reg.GetReg(), rl_i.reg.GetReg());
+    StoreValue(rl_dest, rl_result);
+  }
+  return true;
+}
+
 bool ArmMir2Lir::GenInlinedPeek(CallInfo* info, OpSize size) {
   RegLocation rl_src_address = info->args[0];  // long address
   rl_src_address = NarrowRegLoc(rl_src_address);  // ignore high half in info->args[1]
@@ -156,6 +156,7 @@ class Arm64Mir2Lir FINAL : public Mir2Lir {
                 RegLocation rl_src2) OVERRIDE;
   void GenConversion(Instruction::Code opcode, RegLocation rl_dest, RegLocation rl_src) OVERRIDE;
   bool GenInlinedReverseBits(CallInfo* info, OpSize size) OVERRIDE;
+  bool GenInlinedNumberOfLeadingZeros(CallInfo* info, OpSize size) OVERRIDE;
   bool GenInlinedAbsFloat(CallInfo* info) OVERRIDE;
   bool GenInlinedAbsDouble(CallInfo* info) OVERRIDE;
   bool GenInlinedCas(CallInfo* info, bool is_long, bool is_object) OVERRIDE;
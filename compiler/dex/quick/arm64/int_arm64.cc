@@ -1699,4 +1699,20 @@ bool Arm64Mir2Lir::GenInlinedReverseBits(CallInfo* info, OpSize size) {
   return true;
 }
 
+bool Arm64Mir2Lir::GenInlinedNumberOfLeadingZeros(CallInfo* info, OpSize size) {
+  RegLocation rl_src_i = info->args[0];
+  RegLocation rl_dest = InlineTarget(info);  // int result, also for the long input.
+  RegLocation rl_i = (size == k64) ? LoadValueWide(rl_src_i, kCoreReg)
+                                   : LoadValue(rl_src_i, kCoreReg);
+  RegLocation rl_result = EvalLoc(rl_dest, kCoreReg, true);
+  if (size == k64) {
+    // The wide clz writes the full destination register; the count fits in the low word.
+    NewLIR2(WIDE(kA64Clz2rr), As64BitReg(rl_result.reg).GetReg(), rl_i.reg.GetReg());
+  } else {
+    NewLIR2(kA64Clz2rr, rl_result.reg.GetReg(), rl_i.reg.GetReg());
+  }
+  StoreValue(rl_dest, rl_result);
+  return true;
+}
+
 }  // namespace art
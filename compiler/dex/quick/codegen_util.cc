@@ -361,6 +361,14 @@ void Mir2Lir::CodegenDump() {
 /*
  * Search the existing constants in the literal pool for an exact or close match
  * within specified delta (greater or equal to 0).
+ *
+ * The linear walk is intentional. Pools are per-method and usually a dozen entries, and the
+ * delta parameter asks for a *close* match (so a same-pool literal can be addressed with an
+ * immediate offset from another), which a value-keyed hash cannot answer. Pools also stay
+ * per-method for a structural reason: the interesting shared entries (method and class
+ * literals) are rewritten per method by the linker patches, and a cross-method island would
+ * need its own relocation records plus an in-range guarantee from OatWriter before any
+ * method could rely on it.
  */
 LIR* Mir2Lir::ScanLiteralPool(LIR* data_target, int value, unsigned int delta) {
   while (data_target) {
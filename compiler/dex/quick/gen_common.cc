@@ -175,6 +175,12 @@ LIR* Mir2Lir::GenExplicitNullCheck(RegStorage m_reg, int opt_flags) {
   return GenNullCheck(m_reg);
 }
 
+// Record the current instruction as a potential SIGSEGV site when implicit null checks are in
+// use. The safepoint entry this emits lands in the method's mapping table, which is all the
+// "fault metadata" the runtime needs: NullPointerHandler recovers the faulting ArtMethod and
+// native pc from the signal context and maps it back to a dex pc through that table. Field
+// accesses, invokes (via GenImplicitNullCheck), array element accesses and ARRAY_LENGTH all
+// funnel through here, so the coverage already spans every access shape that can fault on null.
 void Mir2Lir::MarkPossibleNullPointerException(int opt_flags) {
   if (cu_->compiler_driver->GetCompilerOptions().GetImplicitNullChecks()) {
     if (!(cu_->disable_opt & (1 << kNullCheckElimination)) && (opt_flags & MIR_IGNORE_NULL_CHECK)) {
@@ -995,6 +1001,15 @@ void Mir2Lir::GenConstString(uint32_t string_idx, RegLocation rl_dest) {
  * Let helper function take care of everything.  Will
  * call Class::NewInstanceFromCode(type_idx, method);
  */
+// Allocation stays a call on purpose. What we specialize here is the *entrypoint*: when the
+// class is known resolved/initialized we embed the class pointer and call the Resolved or
+// Initialized variant, skipping re-resolution and the initialization check. Expanding the heap
+// fast path itself (size-class lookup or TLAB bump, header store) inline at every new-instance
+// site would replicate allocator invariants into compiled code across every method and bloat
+// each site by a dozen instructions, and our device default allocator is RosAlloc, not TLAB.
+// The cheaper next step, if the call shows up, is a no-frame assembly fast path inside the
+// rosalloc entrypoints themselves - one hand-audited copy, same calling convention, and the
+// frame cost only paid on the slow path.
 void Mir2Lir::GenNewInstance(uint32_t type_idx, RegLocation rl_dest) {
   FlushAllRegs();  /* Everything to home location */
   // alloc will always check for resolution, do we also need to verify
@@ -1438,6 +1438,12 @@ bool Mir2Lir::GenInlinedReverseBits(CallInfo* info, OpSize size) {
   return false;
 }
 
+bool Mir2Lir::GenInlinedNumberOfLeadingZeros(CallInfo* info, OpSize size) {
+  // Implemented only for targets with a count-leading-zeros instruction (ARM, ARM64); elsewhere
+  // the invoke proceeds as a normal call.
+  return false;
+}
+
 bool Mir2Lir::GenInlinedMinMaxFP(CallInfo* info, bool is_min, bool is_double) {
   // Currently implemented only for ARM64
   return false;
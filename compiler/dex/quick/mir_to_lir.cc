@@ -1246,6 +1246,14 @@ void Mir2Lir::MethodMIR2LIR() {
       static_cast<LIR*>(arena_->Alloc(sizeof(LIR) * mir_graph_->GetNumBlocks(),
                                       kArenaAllocLIR));
 
+  // Block layout is pre-order DFS, which approximates dex order with fall-throughs preserved.
+  // Compiler-introduced cold code is already kept out of line: every LIRSlowPath is emitted
+  // after the last block by HandleSlowPaths below, so runtime-call and throw sequences do not
+  // interleave with the hot path. Reordering the bytecode blocks themselves by hotness would
+  // need per-block execution frequencies, and the profile format only records method-level
+  // counts; absent that, deviating from dex order mostly just inserts branches. Splitting cold
+  // blocks into a separate oat region is off the table entirely - a method's code is one
+  // contiguous range located by a single offset, with the mapping and GC map keyed to it.
   PreOrderDfsIterator iter(mir_graph_);
   BasicBlock* curr_bb = iter.Next();
   BasicBlock* next_bb = iter.Next();
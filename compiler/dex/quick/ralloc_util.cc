@@ -1213,6 +1213,13 @@ void Mir2Lir::DoPromotion() {
    * reg.
    * TUNING: replace with linear scan once we have the ability
    * to describe register live ranges for GC.
+   *
+   * Promotion is all-or-nothing per vreg for the whole method: the promotion map is consulted
+   * throughout codegen and RegLocation carries a single home location, so splitting a live
+   * range (promote inside a loop, spill outside) would require per-range locations plus fixup
+   * moves at the split points - effectively the linear scan rewrite above. Until then, the
+   * loop-depth weighting in MIRGraph::CountUses is the knob that decides which vregs win the
+   * callee-save registers.
    */
   size_t core_reg_count_size = WideGPRsAreAliases() ? num_regs : num_regs * 2;
   size_t fp_reg_count_size = WideFPRsAreAliases() ? num_regs : num_regs * 2;
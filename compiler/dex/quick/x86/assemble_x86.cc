@@ -1995,6 +1995,9 @@ void X86Mir2Lir::AssembleLIR() {
    */
 
   while (true) {
+    // Offset assignment has computed the final size, so size the output buffer once up front
+    // instead of growing it a push_back at a time (see the Arm backend).
+    code_buffer_.reserve(total_size_);
     AssemblerStatus res = AssembleInstructions(0);
     if (res == kSuccess) {
       break;
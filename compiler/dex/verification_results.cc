@@ -46,6 +46,14 @@ VerificationResults::~VerificationResults() {
   }
 }
 
+// These results are per-run on purpose. A verdict is not a property of the method's bytes
+// alone: whether a method hard-fails, soft-fails or passes depends on what its references
+// resolve to in the boot image and classpath of *this* compilation, and the safe-cast and
+// devirtualization maps stored here point at concrete methods in that environment. A disk
+// cache keyed by dex checksum would therefore need the boot image identity in its key - and
+// the expensive scenario motivating such a cache, the OTA recompile sweep, is exactly the
+// moment the boot image changes and every entry goes stale. Within one run, methods are
+// verified once; across runs, the environment is the thing that changed.
 bool VerificationResults::ProcessVerifiedMethod(verifier::MethodVerifier* method_verifier) {
   DCHECK(method_verifier != NULL);
   MethodReference ref = method_verifier->GetMethodReference();
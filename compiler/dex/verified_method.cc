@@ -77,6 +77,14 @@ bool VerifiedMethod::IsSafeCast(uint32_t pc) const {
 }
 
 bool VerifiedMethod::GenerateGcMap(verifier::MethodVerifier* method_verifier) {
+  // On the format: the maps written to the oat file are already read in place from the file
+  // mapping at runtime - NativePcOffsetToReferenceMap is an open-addressed hash table of
+  // fixed-width rows probed directly during GC stack walks, nothing is inflated into RAM. That
+  // O(1) probe is exactly what a delta-plus-bitpacked encoding would give up: variable-width
+  // rows force a sequential decode or a side index, trading GC pause time for file size.
+  // Identical maps are also deduplicated by OatWriter, which is where most of the size win of a
+  // fancier encoding already comes from in practice. The dex2oat RSS cost of dex_gc_map_ is
+  // bounded by the compile batch, since each map is released with its VerifiedMethod.
   DCHECK(dex_gc_map_.empty());
   size_t num_entries, ref_bitmap_bits, pc_bits;
   ComputeGcMapSizes(method_verifier, &num_entries, &ref_bitmap_bits, &pc_bits);
@@ -120,6 +120,15 @@ bool MIRGraph::SetHigh(int index) {
  * Infer types and sizes.  We don't need to track change on sizes,
  * as it doesn't propagate.  We're guaranteed at least one pass through
  * the cfg.
+ *
+ * This runs as a repeating topological traversal to fixpoint rather than off a worklist of
+ * changed defs.  A worklist needs def-use chains to know which instructions a changed SSA name
+ * feeds, and SSARepresentation only records uses per MIR, not users per name; building and
+ * maintaining the reverse map is a new structure that every MIR/CFG mutation would have to keep
+ * honest.  Carrying reg_location_ over when the pass reruns after a CFG change is off the table
+ * for a simpler reason: SSA is rebuilt first and the names renumber, so the old table's indices
+ * no longer mean anything.  The lattice only moves one way (bits set, never cleared), so the
+ * repeat traversal stops as soon as a full sweep sees no change.
  */
 bool MIRGraph::InferTypeAndSize(BasicBlock* bb, MIR* mir, bool changed) {
   SSARepresentation *ssa_rep = mir->ssa_rep;
@@ -226,6 +226,14 @@ inline int CompilerDriver::IsFastInvoke(
 
   // Sharpen a virtual call into a direct call when the target is known not to have been
   // overridden (ie is final).
+  //
+  // Note that this is deliberately weaker than class-hierarchy analysis: a non-final method
+  // with no overriding subclass in the boot image could be sharpened the same way, but the
+  // result is only valid until some later class loader introduces an override. Compiled oat
+  // code cannot be invalidated or deoptimized after the fact, so the only hierarchy facts we
+  // may rely on are the ones no class loading can change (finality, the verifier's precise
+  // type for the receiver below). CHA-based sharpening needs dependency tracking plus a
+  // recompile-or-deopt path before it can be attempted here.
   bool can_sharpen_virtual_based_on_type =
       (*invoke_type == kVirtual) && (resolved_method->IsFinal() || methods_class->IsFinal());
   // For invoke-super, ensure the vtable index will be correct to dispatch in the vtable of
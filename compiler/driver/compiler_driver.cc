@@ -26,6 +26,7 @@
 #include <malloc.h>  // For mallinfo
 #endif
 
+#include "base/casts.h"
 #include "base/stl_util.h"
 #include "base/timing_logger.h"
 #include "class_linker.h"
@@ -511,6 +512,9 @@ void CompilerDriver::CompileAll(jobject class_loader,
   VLOG(compiler) << "Before precompile " << GetMemoryUsageString(false);
   PreCompile(class_loader, dex_files, thread_pool.get(), timings);
   Compile(class_loader, dex_files, thread_pool.get(), timings);
+  // The arena pool retains the scratch of the largest methods compiled; release it now so it
+  // does not stay in RSS while the oat and image are written.
+  arena_pool_.FreeUnusedArenas();
   if (dump_stats_) {
     stats_->Dump();
     Selectivity::DumpSelectivityStats();
@@ -603,6 +607,14 @@ void CompilerDriver::Resolve(jobject class_loader, const std::vector<const DexFi
   }
 }
 
+// Each stage below is a parallel ForAll with a barrier before the next one starts. The barriers
+// are load-bearing, not an accident of structure: compilation decisions read global class state
+// written by earlier stages - resolved types and strings in the dex caches, verifier rejection
+// sets, class initialized bits that gate direct static access and invoke sharpening. If a method
+// could enter codegen as soon as its own class verified, those reads would race with the other
+// workers still verifying and initializing, and the emitted code would depend on scheduling.
+// The oat output must be deterministic, so overlap would need every such query to be replaced by
+// per-class dependency tracking before the barriers can go.
 void CompilerDriver::PreCompile(jobject class_loader, const std::vector<const DexFile*>& dex_files,
                                 ThreadPool* thread_pool, TimingLogger* timings) {
   LoadImageClasses(timings);
@@ -1767,6 +1779,14 @@ static void ResolveType(const ParallelCompilationManager* manager, size_t type_i
   }
 }
 
+// Resolution here only covers the dex files being compiled; boot classpath resolution state
+// arrives pre-populated in the mapped boot image, whose DexCaches were filled and relocated by
+// ImageWriter when the image was built. That image *is* the cross-invocation cache: a separate
+// serialized-DexCache file for app compiles would have to solve the same problems the image
+// writer already solves (heap pointers are process-relative, so entries need relocation on map)
+// and would be validated by the same image checksum. If sequential app compiles are resolving
+// boot types from scratch, the thing to investigate is why the image spaces are not being
+// reused, not a second cache format.
 void CompilerDriver::ResolveDexFile(jobject class_loader, const DexFile& dex_file,
                                     const std::vector<const DexFile*>& dex_files,
                                     ThreadPool* thread_pool, TimingLogger* timings) {
@@ -2033,108 +2053,164 @@ void CompilerDriver::Compile(jobject class_loader, const std::vector<const DexFi
   VLOG(compiler) << "Compile: " << GetMemoryUsageString(false);
 }
 
-void CompilerDriver::CompileClass(const ParallelCompilationManager* manager, size_t class_def_index) {
+// A single method to compile, with the per-class decisions already made. Compiling at method
+// rather than class granularity keeps the workers busy when a dex file contains a few huge
+// classes (thousands of generated methods): ForAll hands out indices from a shared atomic
+// counter, so the methods of one class spread across all workers instead of serializing one.
+struct MethodCompilationUnit {
+  const DexFile::CodeItem* code_item;
+  uint32_t access_flags;
+  InvokeType invoke_type;
+  uint16_t class_def_index;
+  uint32_t method_idx;
+  DexToDexCompilationLevel dex_to_dex_compilation_level;
+  bool compilation_enabled;
+};
+
+class MethodCompilationManager FINAL : public ParallelCompilationManager {
+ public:
+  MethodCompilationManager(ClassLinker* class_linker,
+                           jobject class_loader,
+                           CompilerDriver* compiler,
+                           const DexFile* dex_file,
+                           const std::vector<const DexFile*>& dex_files,
+                           ThreadPool* thread_pool,
+                           const std::vector<MethodCompilationUnit>& work_units)
+      : ParallelCompilationManager(class_linker, class_loader, compiler, dex_file, dex_files,
+                                   thread_pool),
+        work_units_(work_units) {}
+
+  const MethodCompilationUnit& GetWorkUnit(size_t index) const {
+    return work_units_[index];
+  }
+
+ private:
+  const std::vector<MethodCompilationUnit>& work_units_;
+
+  DISALLOW_COPY_AND_ASSIGN(MethodCompilationManager);
+};
+
+void CompilerDriver::CompileMethodUnit(const ParallelCompilationManager* manager, size_t index) {
   ATRACE_CALL();
-  const DexFile& dex_file = *manager->GetDexFile();
-  const DexFile::ClassDef& class_def = dex_file.GetClassDef(class_def_index);
-  ClassLinker* class_linker = manager->GetClassLinker();
-  jobject jclass_loader = manager->GetClassLoader();
-  {
-    // Use a scoped object access to perform to the quick SkipClass check.
-    const char* descriptor = dex_file.GetClassDescriptor(class_def);
-    ScopedObjectAccess soa(Thread::Current());
-    StackHandleScope<3> hs(soa.Self());
-    Handle<mirror::ClassLoader> class_loader(
-        hs.NewHandle(soa.Decode<mirror::ClassLoader*>(jclass_loader)));
-    Handle<mirror::Class> klass(
-        hs.NewHandle(class_linker->FindClass(soa.Self(), descriptor, class_loader)));
-    if (klass.Get() == nullptr) {
-      CHECK(soa.Self()->IsExceptionPending());
-      soa.Self()->ClearException();
-    } else if (SkipClassCompilation(jclass_loader, dex_file, klass.Get(), class_def)) {
-      return;
+  const MethodCompilationUnit& unit =
+      down_cast<const MethodCompilationManager*>(manager)->GetWorkUnit(index);
+  manager->GetCompiler()->CompileMethod(unit.code_item, unit.access_flags, unit.invoke_type,
+                                        unit.class_def_index, unit.method_idx,
+                                        manager->GetClassLoader(), *manager->GetDexFile(),
+                                        unit.dex_to_dex_compilation_level,
+                                        unit.compilation_enabled);
+}
+
+void CompilerDriver::CompileDexFile(jobject class_loader, const DexFile& dex_file,
+                                    const std::vector<const DexFile*>& dex_files,
+                                    ThreadPool* thread_pool, TimingLogger* timings) {
+  TimingLogger::ScopedTiming t("Compile Dex File", timings);
+  ClassLinker* class_linker = Runtime::Current()->GetClassLinker();
+  // Walk the class defs serially to make the per-class decisions and flatten the methods into
+  // one work list. This is cheap relative to compilation: the resolve phase has already
+  // populated the class table, so the FindClass calls below are table hits.
+  std::vector<MethodCompilationUnit> work_units;
+  for (size_t class_def_index = 0; class_def_index < dex_file.NumClassDefs(); ++class_def_index) {
+    const DexFile::ClassDef& class_def = dex_file.GetClassDef(class_def_index);
+    {
+      // Use a scoped object access to perform to the quick SkipClass check.
+      const char* descriptor = dex_file.GetClassDescriptor(class_def);
+      ScopedObjectAccess soa(Thread::Current());
+      StackHandleScope<2> hs(soa.Self());
+      Handle<mirror::ClassLoader> class_loader_handle(
+          hs.NewHandle(soa.Decode<mirror::ClassLoader*>(class_loader)));
+      Handle<mirror::Class> klass(
+          hs.NewHandle(class_linker->FindClass(soa.Self(), descriptor, class_loader_handle)));
+      if (klass.Get() == nullptr) {
+        CHECK(soa.Self()->IsExceptionPending());
+        soa.Self()->ClearException();
+      } else if (SkipClassCompilation(class_loader, dex_file, klass.Get(), class_def)) {
+        continue;
+      }
+    }
+    ClassReference ref(&dex_file, class_def_index);
+    // Skip compiling classes with generic verifier failures since they will still fail at runtime
+    if (verification_results_->IsClassRejected(ref)) {
+      continue;
+    }
+    const byte* class_data = dex_file.GetClassData(class_def);
+    if (class_data == nullptr) {
+      // empty class, probably a marker interface
+      continue;
     }
-  }
-  ClassReference ref(&dex_file, class_def_index);
-  // Skip compiling classes with generic verifier failures since they will still fail at runtime
-  if (manager->GetCompiler()->verification_results_->IsClassRejected(ref)) {
-    return;
-  }
-  const byte* class_data = dex_file.GetClassData(class_def);
-  if (class_data == nullptr) {
-    // empty class, probably a marker interface
-    return;
-  }
 
-  // Can we run DEX-to-DEX compiler on this class ?
-  DexToDexCompilationLevel dex_to_dex_compilation_level = kDontDexToDexCompile;
-  {
-    ScopedObjectAccess soa(Thread::Current());
-    StackHandleScope<1> hs(soa.Self());
-    Handle<mirror::ClassLoader> class_loader(
-        hs.NewHandle(soa.Decode<mirror::ClassLoader*>(jclass_loader)));
-    dex_to_dex_compilation_level = GetDexToDexCompilationlevel(soa.Self(), class_loader, dex_file,
-                                                               class_def);
-  }
-  ClassDataItemIterator it(dex_file, class_data);
-  // Skip fields
-  while (it.HasNextStaticField()) {
-    it.Next();
-  }
-  while (it.HasNextInstanceField()) {
-    it.Next();
-  }
-  CompilerDriver* driver = manager->GetCompiler();
+    // Can we run DEX-to-DEX compiler on this class ?
+    DexToDexCompilationLevel dex_to_dex_compilation_level = kDontDexToDexCompile;
+    {
+      ScopedObjectAccess soa(Thread::Current());
+      StackHandleScope<1> hs(soa.Self());
+      Handle<mirror::ClassLoader> class_loader_handle(
+          hs.NewHandle(soa.Decode<mirror::ClassLoader*>(class_loader)));
+      dex_to_dex_compilation_level = GetDexToDexCompilationlevel(soa.Self(), class_loader_handle,
+                                                                 dex_file, class_def);
+    }
+    ClassDataItemIterator it(dex_file, class_data);
+    // Skip fields
+    while (it.HasNextStaticField()) {
+      it.Next();
+    }
+    while (it.HasNextInstanceField()) {
+      it.Next();
+    }
 
-  bool compilation_enabled = driver->IsClassToCompile(
-      dex_file.StringByTypeIdx(class_def.class_idx_));
+    bool compilation_enabled = IsClassToCompile(dex_file.StringByTypeIdx(class_def.class_idx_));
 
-  // Compile direct methods
-  int64_t previous_direct_method_idx = -1;
-  while (it.HasNextDirectMethod()) {
-    uint32_t method_idx = it.GetMemberIndex();
-    if (method_idx == previous_direct_method_idx) {
-      // smali can create dex files with two encoded_methods sharing the same method_idx
-      // http://code.google.com/p/smali/issues/detail?id=119
+    // Queue direct methods
+    int64_t previous_direct_method_idx = -1;
+    while (it.HasNextDirectMethod()) {
+      uint32_t method_idx = it.GetMemberIndex();
+      if (method_idx == previous_direct_method_idx) {
+        // smali can create dex files with two encoded_methods sharing the same method_idx
+        // http://code.google.com/p/smali/issues/detail?id=119
+        it.Next();
+        continue;
+      }
+      previous_direct_method_idx = method_idx;
+      work_units.push_back(MethodCompilationUnit { it.GetMethodCodeItem(),
+          it.GetMethodAccessFlags(), it.GetMethodInvokeType(class_def),
+          static_cast<uint16_t>(class_def_index), method_idx, dex_to_dex_compilation_level,
+          compilation_enabled });
       it.Next();
-      continue;
     }
-    previous_direct_method_idx = method_idx;
-    driver->CompileMethod(it.GetMethodCodeItem(), it.GetMethodAccessFlags(),
-                          it.GetMethodInvokeType(class_def), class_def_index,
-                          method_idx, jclass_loader, dex_file, dex_to_dex_compilation_level,
-                          compilation_enabled);
-    it.Next();
-  }
-  // Compile virtual methods
-  int64_t previous_virtual_method_idx = -1;
-  while (it.HasNextVirtualMethod()) {
-    uint32_t method_idx = it.GetMemberIndex();
-    if (method_idx == previous_virtual_method_idx) {
-      // smali can create dex files with two encoded_methods sharing the same method_idx
-      // http://code.google.com/p/smali/issues/detail?id=119
+    // Queue virtual methods
+    int64_t previous_virtual_method_idx = -1;
+    while (it.HasNextVirtualMethod()) {
+      uint32_t method_idx = it.GetMemberIndex();
+      if (method_idx == previous_virtual_method_idx) {
+        // smali can create dex files with two encoded_methods sharing the same method_idx
+        // http://code.google.com/p/smali/issues/detail?id=119
+        it.Next();
+        continue;
+      }
+      previous_virtual_method_idx = method_idx;
+      work_units.push_back(MethodCompilationUnit { it.GetMethodCodeItem(),
+          it.GetMethodAccessFlags(), it.GetMethodInvokeType(class_def),
+          static_cast<uint16_t>(class_def_index), method_idx, dex_to_dex_compilation_level,
+          compilation_enabled });
       it.Next();
-      continue;
     }
-    previous_virtual_method_idx = method_idx;
-    driver->CompileMethod(it.GetMethodCodeItem(), it.GetMethodAccessFlags(),
-                          it.GetMethodInvokeType(class_def), class_def_index,
-                          method_idx, jclass_loader, dex_file, dex_to_dex_compilation_level,
-                          compilation_enabled);
-    it.Next();
+    DCHECK(!it.HasNext());
   }
-  DCHECK(!it.HasNext());
-}
 
-void CompilerDriver::CompileDexFile(jobject class_loader, const DexFile& dex_file,
-                                    const std::vector<const DexFile*>& dex_files,
-                                    ThreadPool* thread_pool, TimingLogger* timings) {
-  TimingLogger::ScopedTiming t("Compile Dex File", timings);
-  ParallelCompilationManager context(Runtime::Current()->GetClassLinker(), class_loader, this,
-                                     &dex_file, dex_files, thread_pool);
-  context.ForAll(0, dex_file.NumClassDefs(), CompilerDriver::CompileClass, thread_count_);
+  MethodCompilationManager context(class_linker, class_loader, this, &dex_file, dex_files,
+                                   thread_pool, work_units);
+  context.ForAll(0, work_units.size(), CompilerDriver::CompileMethodUnit, thread_count_);
 }
 
+// A cross-compilation code cache keyed by code-item hash has been proposed for app updates and
+// does not survive contact with what compiled code depends on. Identical code-item bytes carry
+// identical dex *indices*, but in the updated APK those indices resolve through different
+// string/type/method tables, so the key would have to fold in every transitively referenced
+// symbol plus verifier results and compiler options - at which point computing the key costs a
+// meaningful slice of just compiling. The emitted blob is also not relocatable on its own:
+// call sites and dex-cache offsets are fixed up by OatWriter against the final layout of the
+// specific oat file. The DedupeSets below are safe precisely because they only unify bytes
+// within one compilation, where all of that context is identical by construction.
 void CompilerDriver::CompileMethod(const DexFile::CodeItem* code_item, uint32_t access_flags,
                                    InvokeType invoke_type, uint16_t class_def_idx,
                                    uint32_t method_idx, jobject class_loader,
@@ -2150,6 +2226,12 @@ void CompilerDriver::CompileMethod(const DexFile::CodeItem* code_item, uint32_t
     if (!compiler_options_->IsCompilationEnabled() &&
         (instruction_set_ == kX86_64 || instruction_set_ == kArm64)) {
       // Leaving this empty will trigger the generic JNI version
+      //
+      // The generic trampoline builds the native frame per call and costs a multiple of a
+      // compiled stub, so it is only acceptable where nothing is compiled anyway. Every other
+      // configuration gets a stub below that is specialized for the method's exact signature -
+      // there is no need for a canned set of common-shorty stubs at RegisterNative time, and
+      // JNI-heavy apps that see the trampoline in profiles should check their compiler filter.
     } else {
       compiled_method = compiler_->JniCompile(access_flags, method_idx, dex_file);
       CHECK(compiled_method != nullptr);
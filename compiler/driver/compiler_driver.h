@@ -734,7 +734,7 @@ class CompilerDriver {
                      bool compilation_enabled)
       LOCKS_EXCLUDED(compiled_methods_lock_);
 
-  static void CompileClass(const ParallelCompilationManager* context, size_t class_def_index)
+  static void CompileMethodUnit(const ParallelCompilationManager* context, size_t index)
       LOCKS_EXCLUDED(Locks::mutator_lock_);
 
   // Swap pool and allocator used for native allocations. May be file-backed. Needs to be first
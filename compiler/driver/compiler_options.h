@@ -203,6 +203,14 @@ class CompilerOptions {
   }
 
   // Should the code be compiled as position independent?
+  // When set (dex2oat --compile-pic), method and class addresses are reached indirectly through
+  // the dex cache instead of being embedded in the instruction stream, so the oat text needs no
+  // relocation and stays clean, file-backed private RSS at whatever address it loads. The ELF
+  // fixup and patchoat passes are skipped for such files. It stays off by default because the
+  // indirection puts a dex-cache load on every sharpened invoke and class reference, which is a
+  // measurable regression on hot code; relocated pages are dirtied once and shared from the
+  // zygote for the boot image, so PIC only clearly wins for per-app oat files where private
+  // dirty pages multiply across processes.
   bool GetCompilePic() const {
     return compile_pic_;
   }
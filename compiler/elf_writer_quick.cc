@@ -640,6 +640,21 @@ bool ElfWriterQuick::ElfBuilder::Write() {
                                             it->GetBuffer()->data(), it->GetBuffer()->size()));
   }
 
+  // Grow the file to its final size in one step before writing. The pieces above are written
+  // out of file order, so without this the filesystem extends the file piecewise behind
+  // back-and-forth seeks and allocates fragmented extents. Best effort: on failure the writes
+  // below still extend the file on demand as before.
+  Elf32_Word expected_size =
+      sections_offset + static_cast<Elf32_Word>(section_ptrs_.size() * sizeof(Elf32_Shdr));
+  for (auto it = other_builders_.begin(); it != other_builders_.end(); ++it) {
+    expected_size = std::max(expected_size,
+        it->section_.sh_offset + static_cast<Elf32_Word>(it->GetBuffer()->size()));
+  }
+  if (elf_file_->SetLength(expected_size) != 0) {
+    PLOG(WARNING) << "Failed to preallocate " << expected_size << " bytes for "
+                  << elf_file_->GetPath();
+  }
+
   if (!WriteOutFile(pieces, elf_file_)) {
     LOG(ERROR) << "Unable to write to file " << elf_file_->GetPath();
 
@@ -24,6 +24,13 @@
 
 namespace art {
 
+// Builds one self-contained hash table per method. Cross-method sharing already happens a level
+// up, as whole tables: the driver's dedupe_gc_map_ DedupeSet collapses identical tables at
+// compile time and OatWriter's InitMapMethodVisitor writes each distinct table once, so the many
+// trivial methods with the same stack shape cost one copy in the oat file. Sharing individual
+// bitmaps *within* distinct tables would not fit this layout -- entries here are probed in place
+// by open-addressed hash on native offset, so bitmap indirection through a dictionary would add
+// a load to every stack-scan probe and a new oat section with its own offsets to maintain.
 class GcMapBuilder {
  public:
   GcMapBuilder(std::vector<uint8_t>* table, size_t entries, uint32_t max_native_offset,
@@ -18,6 +18,7 @@
 
 #include <sys/stat.h>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -54,6 +55,7 @@
 #include "oat_file.h"
 #include "runtime.h"
 #include "scoped_thread_state_change.h"
+#include "thread_pool.h"
 #include "handle_scope-inl.h"
 
 #include <numeric>
@@ -366,6 +368,8 @@ void ImageWriter::AssignImageBinSlot(mirror::Object* object) {
       }
     } else if (object->GetClass<kVerifyNone>()->IsStringClass()) {
       bin = kBinString;  // Strings are almost always immutable (except for object header).
+    } else if (dex_cache_arrays_.find(object) != dex_cache_arrays_.end()) {
+      bin = kBinDexCacheArray;  // Written to by resolution as the app warms up.
     }  // else bin = kBinRegular
   }
 
@@ -386,6 +390,23 @@ void ImageWriter::AssignImageBinSlot(mirror::Object* object) {
   DCHECK_LT(image_end_, image_->Size());
 }
 
+void ImageWriter::PrepareDexCacheArraySlots() {
+  // The dex cache arrays are where runtime resolution lands: resolved types, methods, fields and
+  // interned string references all get written into them as the app warms up, which makes them
+  // the dirtiest arrays in the image by far. Collect them here so that AssignImageBinSlot can
+  // pack them into their own bin instead of scattering them through kBinRegular pages.
+  ClassLinker* class_linker = Runtime::Current()->GetClassLinker();
+  ReaderMutexLock mu(Thread::Current(), *class_linker->DexLock());
+  size_t dex_cache_count = class_linker->GetDexCacheCount();
+  for (size_t i = 0; i < dex_cache_count; ++i) {
+    mirror::DexCache* dex_cache = class_linker->GetDexCache(i);
+    dex_cache_arrays_.insert(dex_cache->GetStrings());
+    dex_cache_arrays_.insert(dex_cache->GetResolvedTypes());
+    dex_cache_arrays_.insert(dex_cache->GetResolvedMethods());
+    dex_cache_arrays_.insert(dex_cache->GetResolvedFields());
+  }
+}
+
 bool ImageWriter::IsImageBinSlotAssigned(mirror::Object* object) const {
   DCHECK(object != nullptr);
 
@@ -909,6 +930,9 @@ void ImageWriter::CalculateNewObjectOffsets(size_t oat_loaded_size, size_t oat_d
     const char* old = self->StartAssertNoThreadSuspension("ImageWriter");
     DCHECK_LT(image_end_, image_->Size());
     image_objects_offset_begin_ = image_end_;
+    // Collect the dex cache arrays before assigning bin slots so they get their own bin. Done
+    // inside the no-suspension region so the collected pointers stay valid across the walk.
+    PrepareDexCacheArraySlots();
     // Clear any pre-existing monitors which may have been in the monitor words, assign bin slots.
     heap->VisitObjects(WalkFieldsCallback, this);
     // Transform each object's bin slot into an offset which will be used to do the final copy.
@@ -953,15 +977,73 @@ void ImageWriter::CalculateNewObjectOffsets(size_t oat_loaded_size, size_t oat_d
   // Note that image_end_ is left at end of used space
 }
 
+static void CollectObjectsCallback(Object* obj, void* arg)
+    SHARED_LOCKS_REQUIRED(Locks::mutator_lock_) {
+  reinterpret_cast<std::vector<Object*>*>(arg)->push_back(obj);
+}
+
+// Copies and fixes up a contiguous range of the collected objects on a pool worker.
+class CopyAndFixupRangeTask : public Task {
+ public:
+  typedef void Callback(Object* obj, void* arg);
+
+  CopyAndFixupRangeTask(Callback* callback, void* arg, Object** objects, size_t count)
+      : callback_(callback), arg_(arg), objects_(objects), count_(count) {}
+
+  void Run(Thread* self) OVERRIDE {
+    ScopedObjectAccess soa(self);
+    for (size_t i = 0; i < count_; ++i) {
+      callback_(objects_[i], arg_);
+    }
+  }
+
+  void Finalize() OVERRIDE {
+    delete this;
+  }
+
+ private:
+  Callback* const callback_;
+  void* const arg_;
+  Object** const objects_;
+  const size_t count_;
+};
+
 void ImageWriter::CopyAndFixupObjects() {
   Thread* self = Thread::Current();
   const char* old_cause = self->StartAssertNoThreadSuspension("ImageWriter");
   gc::Heap* heap = Runtime::Current()->GetHeap();
   // TODO: heap validation can't handle this fix up pass
   heap->DisableObjectValidation();
-  // TODO: Image spaces only?
-  WriterMutexLock mu(self, *Locks::heap_bitmap_lock_);
-  heap->VisitObjects(CopyAndFixupObjectsCallback, this);
+  std::vector<Object*> objects;
+  {
+    // TODO: Image spaces only?
+    WriterMutexLock mu(self, *Locks::heap_bitmap_lock_);
+    heap->VisitObjects(CollectObjectsCallback, &objects);
+  }
+  // Copy and fix up the objects in parallel: each object only writes its own range of the image
+  // buffer, and the shared state read along the way (image offsets stashed in the source lock
+  // words, oat addresses) no longer changes. The bitmap lock is released above because the
+  // workers do not touch the bitmaps and the main thread must not block on the pool holding it.
+  const size_t thread_count = compiler_driver_.GetThreadCount();
+  if (thread_count > 1U && objects.size() >= thread_count) {
+    ThreadPool thread_pool("Image writer thread pool", thread_count - 1);
+    const size_t chunk_size = objects.size() / thread_count + 1;
+    for (size_t start = chunk_size; start < objects.size(); start += chunk_size) {
+      const size_t count = std::min(chunk_size, objects.size() - start);
+      thread_pool.AddTask(self, new CopyAndFixupRangeTask(CopyAndFixupObjectsCallback, this,
+                                                          &objects[start], count));
+    }
+    thread_pool.StartWorkers(self);
+    // The main thread takes the first chunk while the workers drain the rest.
+    for (size_t i = 0; i < chunk_size; ++i) {
+      CopyAndFixupObjectsCallback(objects[i], this);
+    }
+    thread_pool.Wait(self, false, false);
+  } else {
+    for (Object* obj : objects) {
+      CopyAndFixupObjectsCallback(obj, this);
+    }
+  }
   // Fix up the object previously had hash codes.
   for (const std::pair<mirror::Object*, uint32_t>& hash_pair : saved_hashes_) {
     hash_pair.first->SetLockWord(LockWord::FromHashCode(hash_pair.second), false);
@@ -82,6 +82,7 @@ class ImageWriter FINAL {
     kBinClassVerified,            // Class verified, but initializers haven't been run
     kBinArtMethodNative,          // Art method that is actually native
     kBinArtMethodNotInitialized,  // Art method with a declaring class that wasn't initialized
+    kBinDexCacheArray,            // Arrays belonging to dex caches; runtime resolution writes here
     // Don't care about other art methods since they don't dirty
     // Add more bins here if we add more segregation code.
     kBinSize,
@@ -125,6 +126,8 @@ class ImageWriter FINAL {
   size_t GetImageOffset(mirror::Object* object) const SHARED_LOCKS_REQUIRED(Locks::mutator_lock_);
 
   void AssignImageBinSlot(mirror::Object* object) SHARED_LOCKS_REQUIRED(Locks::mutator_lock_);
+  // Remember the arrays owned by the dex caches so that AssignImageBinSlot can segregate them.
+  void PrepareDexCacheArraySlots() SHARED_LOCKS_REQUIRED(Locks::mutator_lock_);
   void SetImageBinSlot(mirror::Object* object, BinSlot bin_slot)
       SHARED_LOCKS_REQUIRED(Locks::mutator_lock_);
   bool IsImageBinSlotAssigned(mirror::Object* object) const
@@ -285,6 +288,10 @@ class ImageWriter FINAL {
   size_t bin_slot_sizes_[kBinSize];  // Number of bytes in a bin
   size_t bin_slot_count_[kBinSize];  // Number of objects in a bin
 
+  // The resolution arrays of the dex caches, collected before bin slot assignment so that they
+  // end up in kBinDexCacheArray.
+  std::set<mirror::Object*> dex_cache_arrays_;
+
   friend class FixupVisitor;
   friend class FixupClassVisitor;
   DISALLOW_COPY_AND_ASSIGN(ImageWriter);
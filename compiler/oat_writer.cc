@@ -463,6 +463,13 @@ class OatWriter::InitCodeMethodVisitor : public OatDexMethodVisitor {
  private:
   // Deduplication is already done on a pointer basis by the compiler driver,
   // so we can simply compare the pointers to find out if things are duplicated.
+  // Together with the driver's DedupeSet this is a complete content-addressed store within one
+  // oat file: identical method bodies collapse to a single copy referenced by code offset here.
+  // Extending it across oat files (sharing getters/accessors between the boot class path and
+  // app oats) does not work in this format: a method entry can only reference code by offset
+  // into its own oat, and code is not position-independent across files (thumb-relative calls,
+  // per-oat trampoline and dex cache offsets), so cross-file sharing would need load-time
+  // relocation that neither the oat format nor patchoat provides.
   SafeMap<const CompiledMethod*, uint32_t, CodeOffsetsKeyComparator> dedupe_map_;
 };
 
@@ -862,6 +869,11 @@ size_t OatWriter::InitOatCodeDexFiles(size_t offset) {
   return offset;
 }
 
+// This is a single forward pass: every offset was fixed by the Init* phases in the constructor,
+// and the Seeks below only skip forward over alignment padding or assert the current position.
+// Nothing is rewritten after the fact, so the stream never needs to back up and the kernel can
+// write previous chunks behind us while we produce the next - a dedicated write-behind thread
+// would duplicate what the page cache does and complicate error reporting for no throughput.
 bool OatWriter::Write(OutputStream* out) {
   const size_t file_offset = out->Seek(0, kSeekCurrent);
 
@@ -42,8 +42,15 @@ class OutputStream;
 //
 // Dex[0]            one variable sized DexFile for each OatDexFile.
 // Dex[1]            these are literal copies of the input .dex files.
-// ...
-// Dex[D]
+// ...               (Literal on purpose: a profile-driven relayout that groups startup-hot
+// Dex[D]            class_data_items/code_items/strings would cut launch page-in, but every
+//                   data item is referenced by absolute file offset from class_defs and
+//                   encoded_methods, so reordering means rewriting the whole cross-reference
+//                   graph plus the dex checksum, and every dex offset recorded in verifier
+//                   metadata, quickened code and debug info would have to be remapped in step.
+//                   That is a standalone dex rewriting tool with its own verifier, not an
+//                   OatWriter pass; until it exists the copy stays byte-identical so offsets
+//                   and checksums remain valid by construction.)
 //
 // OatClass[0]       one variable sized OatClass for each of C DexFile::ClassDefs
 // OatClass[1]       contains OatClass entries with class status, offsets to code, etc.
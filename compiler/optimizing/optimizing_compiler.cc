@@ -190,6 +190,13 @@ CompiledMethod* OptimizingCompiler::TryCompile(const DexFile::CodeItem* code_ite
     class_def_idx, method_idx, access_flags,
     GetCompilerDriver()->GetVerifiedMethod(&dex_file, method_idx));
 
+  // This backend is not yet a candidate for a profile-driven hot-method path: the graph
+  // builder still rejects much of the instruction set, long/FP values only allocate on
+  // x86-64, and instructions needing an environment fall back to baseline codegen (see
+  // RegisterAllocator::CanAllocateRegistersFor). Routing hot methods here before those
+  // gaps close would deoptimize exactly the methods that matter most, so Quick remains
+  // the production backend and this one is exercised through the markers below.
+  //
   // For testing purposes, we put a special marker on method names that should be compiled
   // with this compiler. This makes sure we're not regressing.
   bool shouldCompile = dex_compilation_unit.GetSymbol().find("00024opt_00024") != std::string::npos;
@@ -165,9 +165,16 @@ Arena* ArenaPool::AllocArena(size_t size) {
   Arena* ret = nullptr;
   {
     MutexLock lock(self, lock_);
-    if (free_arenas_ != nullptr && LIKELY(free_arenas_->Size() >= size)) {
-      ret = free_arenas_;
-      free_arenas_ = free_arenas_->next_;
+    // First fit. Checking only the head would force a fresh allocation for every oversized
+    // request (large methods chain oversized arenas) whenever a default-sized arena happens to
+    // sit at the head of the free list; most requests are default-sized and still hit the head.
+    Arena** prev = &free_arenas_;
+    for (Arena* arena = free_arenas_; arena != nullptr; prev = &arena->next_, arena = arena->next_) {
+      if (LIKELY(arena->Size() >= size)) {
+        *prev = arena->next_;
+        ret = arena;
+        break;
+      }
     }
   }
   if (ret == nullptr) {
@@ -177,6 +184,20 @@ Arena* ArenaPool::AllocArena(size_t size) {
   return ret;
 }
 
+void ArenaPool::FreeUnusedArenas() {
+  Arena* free_arenas;
+  {
+    MutexLock lock(Thread::Current(), lock_);
+    free_arenas = free_arenas_;
+    free_arenas_ = nullptr;
+  }
+  while (free_arenas != nullptr) {
+    Arena* arena = free_arenas;
+    free_arenas = free_arenas->next_;
+    delete arena;
+  }
+}
+
 size_t ArenaPool::GetBytesAllocated() const {
   size_t total = 0;
   MutexLock lock(Thread::Current(), lock_);
@@ -150,6 +150,10 @@ class ArenaPool {
   Arena* AllocArena(size_t size) LOCKS_EXCLUDED(lock_);
   void FreeArenaChain(Arena* first) LOCKS_EXCLUDED(lock_);
   size_t GetBytesAllocated() const LOCKS_EXCLUDED(lock_);
+  // Release the memory held by the free arenas back to the system. The pool retains every arena
+  // ever handed out, so on low-memory devices a caller should drop the free list once a
+  // compilation phase no longer needs arena-sized scratch.
+  void FreeUnusedArenas() LOCKS_EXCLUDED(lock_);
 
  private:
   mutable Mutex lock_ DEFAULT_MUTEX_ACQUIRED_AFTER;
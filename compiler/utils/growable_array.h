@@ -108,8 +108,16 @@ class GrowableArray {
         num_allocated_(init_length),
         num_used_(0),
         kind_(kind) {
-      elem_list_ = static_cast<T*>(arena_->Alloc(sizeof(T) * init_length,
-                                                 kArenaAllocGrowableArray));
+      if (init_length <= kSmallStorageCount) {
+        // Keep short lists in the object itself. MIRGraph creates thousands of predecessor and
+        // successor lists that never outgrow a couple of entries; starting them inline avoids a
+        // separate arena allocation per list and the slack it leaves behind when lists grow.
+        elem_list_ = reinterpret_cast<T*>(small_storage_);
+        num_allocated_ = kSmallStorageCount;
+      } else {
+        elem_list_ = static_cast<T*>(arena_->Alloc(sizeof(T) * init_length,
+                                                   kArenaAllocGrowableArray));
+      }
     };
 
 
@@ -235,11 +243,20 @@ class GrowableArray {
     }
 
   private:
+    // Lists no longer than this are stored in small_storage_ instead of the arena. Kept as raw
+    // words rather than a T array since not all element types are default-constructible; elements
+    // have always been moved with memcpy on Resize(), so T must be trivially copyable regardless.
+    // Note that copying a GrowableArray would leave elem_list_ pointing into the source object;
+    // arrays are placement-new'ed into the arena or stack-local and are never copied.
+    static const size_t kSmallStorageCount = 4;
+
     ArenaAllocator* const arena_;
     size_t num_allocated_;
     size_t num_used_;
     OatListKind kind_;
     T* elem_list_;
+    uint64_t small_storage_[(kSmallStorageCount * sizeof(T) + sizeof(uint64_t) - 1) /
+                            sizeof(uint64_t)];
 };
 
 }  // namespace art
@@ -154,7 +154,9 @@ static void Usage(const char* fmt, ...) {
   UsageError("      Default: arm");
   UsageError("");
   UsageError("  --instruction-set-features=...,: Specify instruction set features");
+  UsageError("      Use 'runtime' to detect features from the CPU dex2oat is running on.");
   UsageError("      Example: --instruction-set-features=div");
+  UsageError("      Example: --instruction-set-features=runtime");
   UsageError("      Default: default");
   UsageError("");
   UsageError("  --compile-pic: Force indirect use of code, methods, and classes");
@@ -210,6 +212,9 @@ static void Usage(const char* fmt, ...) {
   UsageError("");
   UsageError("  --dump-timing: display a breakdown of where time was spent");
   UsageError("");
+  UsageError("  --dump-passes: display per-pass compile times, accumulated across all compiled");
+  UsageError("      methods. Useful for attributing compile-time regressions to a backend pass.");
+  UsageError("");
   UsageError("  --include-patch-information: Include patching information so the generated code");
   UsageError("      can have its base address moved without full recompilation.");
   UsageError("");
@@ -254,6 +259,14 @@ static void Usage(const char* fmt, ...) {
   exit(EXIT_FAILURE);
 }
 
+// One process, one compile. Reusing a booted runtime across a batch of apps looks attractive
+// for the OTA loop, but the runtime has no class unloading: every app's resolved classes,
+// intern strings and verifier failure records would pile up in the shared ClassLinker for the
+// life of the batch, growing memory monotonically and letting one app's verification state leak
+// into the next job's oat file. Error handling is also process-scoped -- compiler OOM and
+// malformed-dex paths LOG(FATAL) or exit(), which in a daemon takes down every queued job.
+// Until classes can be unloaded, the clean per-job isolation is the process boundary; the boot
+// image and zygote-style fork tricks are the sanctioned ways to make that boundary cheaper.
 class Dex2Oat {
  public:
   static bool Create(Dex2Oat** p_dex2oat,
@@ -420,6 +433,12 @@ class Dex2Oat {
 
     driver->GetCompiler()->SetBitcodeFileName(*driver.get(), bitcode_filename);
 
+    // Everything below recompiles from scratch even when only part of a multidex APK changed.
+    // Reusing compiled methods for unchanged classes from the previous oat does not work with
+    // this oat format: compiled code embeds dex-relative string/type/method indices and
+    // oat-relative offsets (dex cache arrays, trampolines, relative calls), all of which shift
+    // when any dex file in the APK changes, and there is no relocation info to fix them up.
+    // Incremental compilation therefore needs a format change, not just per-class checksums.
     driver->CompileAll(class_loader, dex_files, &timings);
 
     TimingLogger::ScopedTiming t2("dex2oat OatWriter", &timings);
@@ -766,6 +785,10 @@ static InstructionSetFeatures ParseFeatureList(std::string str) {
     } else if (feature == "nolpae") {
       // Turn off support for Large Physical Address Extension.
       result.SetHasLpae(false);
+    } else if (feature == "runtime") {
+      // Take whatever the CPU we are running on advertises. Only meaningful when compiling
+      // for the same instruction set as the device doing the compiling.
+      result = InstructionSetFeatures::GuessInstructionSetFeatures();
     } else {
       Usage("Unknown instruction set feature: '%s'", feature.c_str());
     }
@@ -247,7 +247,8 @@ void DisassemblerArm::DumpArm(std::ostream& os, const uint8_t* instr_ptr) {
   uint32_t op1 = (instruction >> 25) & 0x7;
   std::string opcode;
   std::string suffixes;
-  std::ostringstream args;
+  std::ostringstream& args = scratch_args_;
+  args.str("");
   switch (op1) {
     case 0:
     case 1:  // Data processing instructions.
@@ -451,8 +452,10 @@ size_t DisassemblerArm::DumpThumb32(std::ostream& os, const uint8_t* instr_ptr)
   }
 
   uint32_t op2 = (instr >> 20) & 0x7F;
-  std::ostringstream opcode;
-  std::ostringstream args;
+  std::ostringstream& opcode = scratch_opcode_;
+  std::ostringstream& args = scratch_args_;
+  opcode.str("");
+  args.str("");
   switch (op1) {
     case 0:
       break;
@@ -1622,8 +1625,10 @@ size_t DisassemblerArm::DumpThumb16(std::ostream& os, const uint8_t* instr_ptr)
   if (is_32bit) {
     return DumpThumb32(os, instr_ptr);
   } else {
-    std::ostringstream opcode;
-    std::ostringstream args;
+    std::ostringstream& opcode = scratch_opcode_;
+    std::ostringstream& args = scratch_args_;
+    opcode.str("");
+    args.str("");
     uint16_t opcode1 = instr >> 10;
     if (opcode1 < 0x10) {
       // shift (immediate), add, subtract, move, and compare
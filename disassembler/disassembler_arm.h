@@ -17,6 +17,7 @@
 #ifndef ART_DISASSEMBLER_DISASSEMBLER_ARM_H_
 #define ART_DISASSEMBLER_DISASSEMBLER_ARM_H_
 
+#include <sstream>
 #include <vector>
 
 #include "disassembler.h"
@@ -44,6 +45,13 @@ class DisassemblerArm FINAL : public Disassembler {
 
   std::vector<const char*> it_conditions_;
 
+  // Scratch streams shared by DumpArm/DumpThumb16/DumpThumb32; at most one instruction is in
+  // flight per instance, and delegation between the Dump* methods happens before the streams
+  // are touched. Reusing them keeps ostringstream construction (locale setup plus the initial
+  // buffer allocation) off the per-instruction path, which dominates bulk oatdump time.
+  std::ostringstream scratch_opcode_;
+  std::ostringstream scratch_args_;
+
   DISALLOW_COPY_AND_ASSIGN(DisassemblerArm);
 };
 
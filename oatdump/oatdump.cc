@@ -102,6 +102,22 @@ static void usage() {
           "  --no-disassemble may be used to disable disassembly.\n"
           "      Example: --no-disassemble\n"
           "\n");
+  fprintf(stderr,
+          "  --class-filter=<descriptor substring>: only dumps classes whose descriptor\n"
+          "      contains the substring.\n"
+          "      Example: --class-filter=Landroid/view/View\n"
+          "\n");
+  fprintf(stderr,
+          "  --method-filter=<method name substring>: only dumps methods whose pretty\n"
+          "      name contains the substring.\n"
+          "      Example: --method-filter=onMeasure\n"
+          "\n");
+  fprintf(stderr,
+          "  --method-stats: instead of the normal dump, print one CSV row per compiled\n"
+          "      method with its code, mapping table, vmap table and GC map sizes in\n"
+          "      bytes. Honors --class-filter and --method-filter.\n"
+          "      Example: --method-stats\n"
+          "\n");
   exit(EXIT_FAILURE);
 }
 
@@ -123,17 +139,26 @@ class OatDumperOptions {
                    bool dump_raw_gc_map,
                    bool dump_vmap,
                    bool disassemble_code,
+                   const char* class_filter,
+                   const char* method_filter,
+                   bool dump_method_stats,
                    bool absolute_addresses)
     : dump_raw_mapping_table_(dump_raw_mapping_table),
       dump_raw_gc_map_(dump_raw_gc_map),
       dump_vmap_(dump_vmap),
       disassemble_code_(disassemble_code),
+      class_filter_(class_filter),
+      method_filter_(method_filter),
+      dump_method_stats_(dump_method_stats),
       absolute_addresses_(absolute_addresses) {}
 
   const bool dump_raw_mapping_table_;
   const bool dump_raw_gc_map_;
   const bool dump_vmap_;
   const bool disassemble_code_;
+  const char* const class_filter_;
+  const char* const method_filter_;
+  const bool dump_method_stats_;
   const bool absolute_addresses_;
 };
 
@@ -161,6 +186,11 @@ class OatDumper {
 
   bool Dump(std::ostream& os) {
     bool success = true;
+    // The stats dump replaces the textual one entirely so that the output can be fed
+    // straight into sort/awk without scraping.
+    if (options_->dump_method_stats_) {
+      return DumpMethodStats(os);
+    }
     const OatHeader& oat_header = oat_file_.GetOatHeader();
 
     os << "MAGIC:\n";
@@ -378,6 +408,12 @@ class OatDumper {
          class_def_index++) {
       const DexFile::ClassDef& class_def = dex_file->GetClassDef(class_def_index);
       const char* descriptor = dex_file->GetClassDescriptor(class_def);
+      // Filtered dumps exist so CI can diff a handful of classes without paying for a full
+      // disassembly pass over the file.
+      if (options_->class_filter_[0] != '\0' &&
+          strstr(descriptor, options_->class_filter_) == nullptr) {
+        continue;
+      }
       uint32_t oat_class_offset = oat_dex_file.GetOatClassOffset(class_def_index);
       const OatFile::OatClass oat_class = oat_dex_file.GetOatClass(class_def_index);
       os << StringPrintf("%zd: %s (offset=0x%08x) (type_idx=%d)",
@@ -439,6 +475,82 @@ class OatDumper {
     return success;
   }
 
+  // One CSV row per compiled method, sized for answering "which methods account for most of
+  // this oat file". Blob sizes come from the same offset map the disassembler uses to find
+  // the end of a region, so no extra size fields are needed in the oat format; the flip side
+  // is that a deduplicated table shared by several methods is charged in full to each of them.
+  bool DumpMethodStats(std::ostream& os) {
+    bool success = true;
+    os << "code_bytes,mapping_table_bytes,vmap_table_bytes,gc_map_bytes,total_bytes,"
+       << "dex_method_idx,method\n";
+    for (size_t i = 0; i < oat_dex_files_.size(); i++) {
+      const OatFile::OatDexFile* oat_dex_file = oat_dex_files_[i];
+      CHECK(oat_dex_file != nullptr);
+      std::string error_msg;
+      std::unique_ptr<const DexFile> dex_file(oat_dex_file->OpenDexFile(&error_msg));
+      if (dex_file.get() == nullptr) {
+        LOG(WARNING) << "Failed to open dex file '" << oat_dex_file->GetDexFileLocation()
+            << "': " << error_msg;
+        success = false;
+        continue;
+      }
+      for (size_t class_def_index = 0;
+           class_def_index < dex_file->NumClassDefs();
+           class_def_index++) {
+        const DexFile::ClassDef& class_def = dex_file->GetClassDef(class_def_index);
+        const char* descriptor = dex_file->GetClassDescriptor(class_def);
+        if (options_->class_filter_[0] != '\0' &&
+            strstr(descriptor, options_->class_filter_) == nullptr) {
+          continue;
+        }
+        const OatFile::OatClass oat_class = oat_dex_file->GetOatClass(class_def_index);
+        const byte* class_data = dex_file->GetClassData(class_def);
+        if (class_data == nullptr) {
+          continue;
+        }
+        ClassDataItemIterator it(*dex_file.get(), class_data);
+        SkipAllFields(it);
+        uint32_t class_method_index = 0;
+        while (it.HasNextDirectMethod()) {
+          DumpMethodStatsRow(os, oat_class, *dex_file.get(), it.GetMemberIndex(),
+                             class_method_index++);
+          it.Next();
+        }
+        while (it.HasNextVirtualMethod()) {
+          DumpMethodStatsRow(os, oat_class, *dex_file.get(), it.GetMemberIndex(),
+                             class_method_index++);
+          it.Next();
+        }
+        DCHECK(!it.HasNext());
+      }
+    }
+    os << std::flush;
+    return success;
+  }
+
+  void DumpMethodStatsRow(std::ostream& os, const OatFile::OatClass& oat_class,
+                          const DexFile& dex_file, uint32_t dex_method_idx,
+                          uint32_t class_method_index) {
+    std::string pretty_method = PrettyMethod(dex_method_idx, dex_file, true);
+    if (options_->method_filter_[0] != '\0' &&
+        pretty_method.find(options_->method_filter_) == std::string::npos) {
+      return;
+    }
+    const OatFile::OatMethod oat_method = oat_class.GetOatMethod(class_method_index);
+    uint32_t code_size = oat_method.GetQuickCodeSize();
+    if (oat_method.GetQuickCode() == nullptr) {
+      code_size = oat_method.GetPortableCodeSize();
+    }
+    size_t mapping_table_size = ComputeSize(oat_method.GetMappingTable());
+    size_t vmap_table_size = ComputeSize(oat_method.GetVmapTable());
+    size_t gc_map_size = ComputeSize(oat_method.GetGcMap());
+    size_t total = code_size + mapping_table_size + vmap_table_size + gc_map_size;
+    // Pretty method names contain commas in the signature, so the name column is quoted.
+    os << StringPrintf("%u,%zu,%zu,%zu,%zu,%u,\"%s\"\n",
+                       code_size, mapping_table_size, vmap_table_size, gc_map_size, total,
+                       dex_method_idx, pretty_method.c_str());
+  }
+
   static constexpr uint32_t kPrologueBytes = 16;
 
   // When this was picked, the largest arm method was 55,256 bytes and arm64 was 50,412 bytes.
@@ -450,8 +562,13 @@ class OatDumper {
                      uint32_t dex_method_idx, const DexFile::CodeItem* code_item,
                      uint32_t method_access_flags) {
     bool success = true;
+    std::string pretty_method = PrettyMethod(dex_method_idx, dex_file, true);
+    if (options_->method_filter_[0] != '\0' &&
+        pretty_method.find(options_->method_filter_) == std::string::npos) {
+      return success;
+    }
     os << StringPrintf("%d: %s (dex_method_idx=%d)\n",
-                       class_method_index, PrettyMethod(dex_method_idx, dex_file, true).c_str(),
+                       class_method_index, pretty_method.c_str(),
                        dex_method_idx);
     Indenter indent1_filter(os.rdbuf(), kIndentChar, kIndentBy1Count);
     std::unique_ptr<std::ostream> indent1_os(new std::ostream(&indent1_filter));
@@ -1711,6 +1828,9 @@ static int oatdump(int argc, char** argv) {
   bool dump_raw_gc_map = false;
   bool dump_vmap = true;
   bool disassemble_code = true;
+  const char* class_filter = "";
+  const char* method_filter = "";
+  bool dump_method_stats = false;
 
   for (int i = 0; i < argc; i++) {
     const StringPiece option(argv[i]);
@@ -1741,6 +1861,12 @@ static int oatdump(int argc, char** argv) {
       dump_vmap = false;
     } else if (option == "--no-disassemble") {
       disassemble_code = false;
+    } else if (option.starts_with("--class-filter=")) {
+      class_filter = option.substr(strlen("--class-filter=")).data();
+    } else if (option.starts_with("--method-filter=")) {
+      method_filter = option.substr(strlen("--method-filter=")).data();
+    } else if (option == "--method-stats") {
+      dump_method_stats = true;
     } else if (option.starts_with("--output=")) {
       const char* filename = option.substr(strlen("--output=")).data();
       out.reset(new std::ofstream(filename));
@@ -1771,6 +1897,9 @@ static int oatdump(int argc, char** argv) {
                                                                             dump_raw_gc_map,
                                                                             dump_vmap,
                                                                             disassemble_code,
+                                                                            class_filter,
+                                                                            method_filter,
+                                                                            dump_method_stats,
                                                                             absolute_addresses));
   MemMap::Init();
   if (oat_filename != nullptr) {
@@ -44,6 +44,10 @@ class Mutex;
 // quasiatomic operations that are performed on partially-overlapping
 // memory.
 class QuasiAtomic {
+  // The striped mutex pool is a 32-bit MIPS fallback only. Every ARM target we build for is
+  // ARMv7 or newer where ldrexd/strexd are architectural, so the inline assembly paths below are
+  // taken unconditionally there and AtomicLong.VMSupportsCS8 reports true; there is nothing to
+  // detect at runtime.
 #if defined(__mips__) && !defined(__LP64__)
   static constexpr bool kNeedSwapMutexes = true;
 #else
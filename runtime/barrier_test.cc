@@ -23,6 +23,7 @@
 #include "mirror/object_array-inl.h"
 #include "thread_pool.h"
 #include "thread-inl.h"
+#include "utils.h"
 
 namespace art {
 class CheckWaitTask : public Task {
@@ -127,4 +128,69 @@ TEST_F(BarrierTest, CheckPass) {
   EXPECT_EQ(count.LoadRelaxed(), expected_total_tasks);
 }
 
+class TimedWaitTask : public Task {
+ public:
+  TimedWaitTask(Barrier* barrier, AtomicInteger* ready_count, Atomic<uint64_t>* latest_wake_ns)
+      : barrier_(barrier),
+        ready_count_(ready_count),
+        latest_wake_ns_(latest_wake_ns) {}
+
+  void Run(Thread* self) {
+    ++*ready_count_;
+    barrier_->Wait(self);
+    // Record the latest wakeup time seen by any waiter; several workers race to finish.
+    uint64_t now = NanoTime();
+    uint64_t prev = latest_wake_ns_->LoadRelaxed();
+    while (now > prev) {
+      if (latest_wake_ns_->CompareExchangeWeakRelaxed(prev, now)) {
+        break;
+      }
+      prev = latest_wake_ns_->LoadRelaxed();
+    }
+  }
+
+  virtual void Finalize() {
+    delete this;
+  }
+
+ private:
+  Barrier* const barrier_;
+  AtomicInteger* const ready_count_;
+  Atomic<uint64_t>* const latest_wake_ns_;
+};
+
+// Measure how long it takes the last of n waiters to get through the barrier once the final
+// arrival releases it. This is the wakeup path behind checkpoint completion and GC phase
+// handoffs; the numbers are logged rather than asserted on, so regressions show up in test
+// logs without making the test flaky on loaded machines. Note the ready count is incremented
+// just before Wait(), so a waiter that has announced itself but not yet blocked adds its
+// entry to the measured time - acceptable for tracking trends.
+TEST_F(BarrierTest, WakeupLatency) {
+  Thread* self = Thread::Current();
+  static const int32_t kWaiterCounts[] = { 4, 8, 16, 32, 64 };
+  for (size_t i = 0; i < arraysize(kWaiterCounts); ++i) {
+    const int32_t waiters = kWaiterCounts[i];
+    ThreadPool thread_pool("Barrier wakeup test thread pool", waiters);
+    Barrier barrier(waiters + 1);  // One extra Wait() in main thread.
+    Barrier timeout_barrier(0);  // Only used for sleeping on timeout.
+    AtomicInteger ready_count(0);
+    Atomic<uint64_t> latest_wake_ns(0);
+    for (int32_t j = 0; j < waiters; ++j) {
+      thread_pool.AddTask(self, new TimedWaitTask(&barrier, &ready_count, &latest_wake_ns));
+    }
+    thread_pool.StartWorkers(self);
+    while (ready_count.LoadRelaxed() != waiters) {
+      timeout_barrier.Increment(self, 1, 100);  // sleep 100 msecs
+    }
+    const uint64_t release_ns = NanoTime();
+    barrier.Wait(self);
+    thread_pool.Wait(self, true, false);
+    const uint64_t last_wake_ns = latest_wake_ns.LoadRelaxed();
+    EXPECT_GE(last_wake_ns, release_ns);
+    LOG(INFO) << "Barrier wakeup with " << waiters << " waiters: last waiter through in "
+              << PrettyDuration(last_wake_ns - release_ns);
+    timeout_barrier.Init(self, 0);  // Reset to zero for destruction.
+  }
+}
+
 }  // namespace art
@@ -119,15 +119,23 @@ void InitLogging(char* argv[]) {
   }
 }
 
+static const char* FileBasename(const char* file) {
+  const char* last_slash = strrchr(file, '/');
+  return (last_slash == NULL) ? file : last_slash + 1;
+}
+
 LogMessageData::LogMessageData(const char* file, int line, LogSeverity severity, int error)
-    : file(file),
+    : file(FileBasename(file)),
       line_number(line),
       severity(severity),
       error(error) {
-  const char* last_slash = strrchr(file, '/');
-  file = (last_slash == NULL) ? file : last_slash + 1;
 }
 
+// Formatting happens in the caller's stream and emission is synchronous under logging_lock_ on
+// purpose. The lock is what keeps multi-line messages from interleaving across threads, and a
+// per-thread deferred-format ring would trade that (and the completeness of the log at crash
+// time, which HandleUnexpectedSignal depends on) for throughput that only matters when verbose
+// logging is on. Timing-sensitive investigations should lean on systrace, not verbose logs.
 LogMessage::~LogMessage() {
   if (data_->severity < gMinimumLogSeverity) {
     return;  // No need to format something we're not going to output.
@@ -195,8 +195,11 @@ inline void ReaderWriterMutex::SharedUnlock(Thread* self) {
       if (done && (cur_state - 1) == 0) {  // Weak CAS may fail spuriously.
         if (num_pending_writers_.LoadRelaxed() > 0 ||
             num_pending_readers_.LoadRelaxed() > 0) {
-          // Wake any exclusive waiters as there are now no readers.
-          futex(state_.Address(), FUTEX_WAKE, -1, NULL, NULL, 0);
+          // Wake any exclusive waiters as there are now no readers. One wakeup suffices when only
+          // writers are queued (the woken writer passes the wakeup on at its unlock), but readers
+          // draining from a recent exclusive phase must all be woken.
+          int num_to_wake = (num_pending_readers_.LoadRelaxed() > 0) ? -1 : 1;
+          futex(state_.Address(), FUTEX_WAKE, num_to_wake, NULL, NULL, 0);
         }
       }
     } else {
@@ -541,10 +541,14 @@ void ReaderWriterMutex::ExclusiveUnlock(Thread* self) {
       // a status bit into the state on contention.
       done =  state_.CompareExchangeWeakSequentiallyConsistent(-1 /* cur_state*/, 0 /* new state */);
       if (LIKELY(done)) {  // Weak CAS may fail spuriously.
-        // Wake any waiters.
+        // Wake any waiters. Pending readers must all be woken together, but if only writers are
+        // queued a single wakeup suffices: the woken writer passes the wakeup on when it unlocks.
+        // A waiter that enqueues between the CAS above and the wake is not stranded - FUTEX_WAIT
+        // revalidates the state word and returns EAGAIN once it has changed.
         if (UNLIKELY(num_pending_readers_.LoadRelaxed() > 0 ||
                      num_pending_writers_.LoadRelaxed() > 0)) {
-          futex(state_.Address(), FUTEX_WAKE, -1, NULL, NULL, 0);
+          int num_to_wake = (num_pending_readers_.LoadRelaxed() > 0) ? -1 : 1;
+          futex(state_.Address(), FUTEX_WAKE, num_to_wake, NULL, NULL, 0);
         }
       }
     } else {
@@ -112,7 +112,11 @@ const bool kDebugLocking = kIsDebugBuild;
 
 // Record Log contention information, dumpable via SIGQUIT.
 #ifdef ART_USE_FUTEXES
-// To enable lock contention logging, set this to true.
+// To enable lock contention logging, set this to true. Making this a runtime flag (e.g. sampled
+// always-on collection in production) would not be cheap to bolt on: the per-lock log tables
+// below are sized by this constant so the release-build cost is exactly zero, and a runtime
+// check would put a load on every uncontended acquire. Flip the constant for data-collection
+// builds instead.
 const bool kLogLockContentions = false;
 #else
 // Keep this false as lock contention logging is supported only with
@@ -280,6 +284,15 @@ class LOCKABLE Mutex : public BaseMutex {
 // Exclusive | Block         | Free            | Block            | error
 // Shared(n) | Block         | error           | SharedLock(n+1)* | Shared(n-1) or Free
 // * for large values of n the SharedLock may block.
+//
+// The futex implementation is reader-preferring: readers may barge past queued writers. This is
+// deliberate for the dominant user, the mutator lock. Writer priority there is provided one level
+// up by the suspension protocol - SuspendAll raises every thread's suspend count before blocking
+// for exclusive access, so runnable threads release their shared holds at the next suspend point
+// and new readers first pass through a suspend check; a writer-preference bit here would only
+// duplicate that and penalize the common shared-acquire fast path. There is likewise no
+// exclusive-to-shared downgrade: writer sections are either suspend-all scoped (where ResumeAll
+// must fully release) or short enough that a release/reacquire pair is not measurable.
 std::ostream& operator<<(std::ostream& os, const ReaderWriterMutex& mu);
 class LOCKABLE ReaderWriterMutex : public BaseMutex {
  public:
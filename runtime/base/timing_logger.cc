@@ -129,14 +129,23 @@ void CumulativeLogger::DumpHistogram(std::ostream &os) const {
 
 TimingLogger::TimingLogger(const char* name, bool precise, bool verbose)
     : name_(name), precise_(precise), verbose_(verbose) {
+  // Loggers are reused across iterations (e.g. the one in Heap's current GC iteration), so
+  // reserving up front means StartTiming/EndTiming only ever malloc if a phase set outgrows
+  // every previous one. That keeps the recording cost inside GC pauses down to one clock read
+  // and one 16-byte store.
+  timings_.reserve(kDefaultCapacity);
 }
 
 void TimingLogger::Reset() {
+  // clear() keeps the vector's capacity, which is what makes the reservation above stick.
   timings_.clear();
 }
 
 void TimingLogger::StartTiming(const char* label) {
   DCHECK(label != nullptr);
+  // NanoTime() is clock_gettime(CLOCK_MONOTONIC), which the vDSO services from the cycle
+  // counter on our targets without a kernel entry; reading TSC/CNTVCT directly would save
+  // little and would need per-device frequency calibration to report nanoseconds.
   timings_.push_back(Timing(NanoTime(), label));
   ATRACE_BEGIN(label);
 }
@@ -78,6 +78,9 @@ class CumulativeLogger {
 class TimingLogger {
  public:
   static constexpr size_t kIndexNotFound = static_cast<size_t>(-1);
+  // Enough for the deepest phase sets we record (a full CMS iteration is ~40 start/end pairs);
+  // reserved at construction so recording a split does not allocate.
+  static constexpr size_t kDefaultCapacity = 128;
 
   class Timing {
    public:
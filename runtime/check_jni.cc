@@ -153,7 +153,9 @@ class ScopedCheck {
       SHARED_LOCK_FUNCTION(Locks::mutator_lock_)
       : soa_(env) {
     Init(flags, functionName, true);
-    CheckThread(flags);
+    if (LIKELY(checking_)) {
+      CheckThread(flags);
+    }
   }
 
   // For JavaVM* functions.
@@ -179,6 +181,9 @@ class ScopedCheck {
   // times, so using "java.lang.Thread" instead of "java/lang/Thread" might work in some
   // circumstances, but this is incorrect.
   void CheckClassName(const char* class_name) {
+    if (UNLIKELY(!checking_)) {
+      return;
+    }
     if ((class_name == nullptr) || !IsValidJniClassName(class_name)) {
       JniAbortF(function_name_,
                 "illegal class name '%s'\n"
@@ -195,6 +200,9 @@ class ScopedCheck {
    */
   void CheckFieldType(jvalue value, jfieldID fid, char prim, bool isStatic)
       SHARED_LOCKS_REQUIRED(Locks::mutator_lock_) {
+    if (UNLIKELY(!checking_)) {
+      return;
+    }
     StackHandleScope<1> hs(Thread::Current());
     Handle<mirror::ArtField> f(hs.NewHandle(CheckFieldID(fid)));
     if (f.Get() == nullptr) {
@@ -246,6 +254,9 @@ class ScopedCheck {
    */
   void CheckInstanceFieldID(jobject java_object, jfieldID fid)
       SHARED_LOCKS_REQUIRED(Locks::mutator_lock_) {
+    if (UNLIKELY(!checking_)) {
+      return;
+    }
     mirror::Object* o = soa_.Decode<mirror::Object*>(java_object);
     if (o == nullptr || !Runtime::Current()->GetHeap()->IsValidObjectAddress(o)) {
       Runtime::Current()->GetHeap()->DumpSpaces(LOG(ERROR));
@@ -269,6 +280,9 @@ class ScopedCheck {
    * Verify that the pointer value is non-NULL.
    */
   void CheckNonNull(const void* ptr) {
+    if (UNLIKELY(!checking_)) {
+      return;
+    }
     if (ptr == nullptr) {
       JniAbortF(function_name_, "non-nullable argument was NULL");
     }
@@ -280,6 +294,9 @@ class ScopedCheck {
    */
   void CheckSig(jmethodID mid, const char* expectedType, bool isStatic)
       SHARED_LOCKS_REQUIRED(Locks::mutator_lock_) {
+    if (UNLIKELY(!checking_)) {
+      return;
+    }
     mirror::ArtMethod* m = CheckMethodID(mid);
     if (m == nullptr) {
       return;
@@ -306,6 +323,9 @@ class ScopedCheck {
    */
   void CheckStaticFieldID(jclass java_class, jfieldID fid)
       SHARED_LOCKS_REQUIRED(Locks::mutator_lock_) {
+    if (UNLIKELY(!checking_)) {
+      return;
+    }
     mirror::Class* c = soa_.Decode<mirror::Class*>(java_class);
     mirror::ArtField* f = CheckFieldID(fid);
     if (f == nullptr) {
@@ -328,6 +348,9 @@ class ScopedCheck {
    */
   void CheckStaticMethod(jclass java_class, jmethodID mid)
       SHARED_LOCKS_REQUIRED(Locks::mutator_lock_) {
+    if (UNLIKELY(!checking_)) {
+      return;
+    }
     mirror::ArtMethod* m = CheckMethodID(mid);
     if (m == nullptr) {
       return;
@@ -348,6 +371,9 @@ class ScopedCheck {
    */
   void CheckVirtualMethod(jobject java_object, jmethodID mid)
       SHARED_LOCKS_REQUIRED(Locks::mutator_lock_) {
+    if (UNLIKELY(!checking_)) {
+      return;
+    }
     mirror::ArtMethod* m = CheckMethodID(mid);
     if (m == nullptr) {
       return;
@@ -398,6 +424,9 @@ class ScopedCheck {
    * Use the kFlag_NullableUtf flag where 'u' field(s) are nullable.
    */
   void Check(bool entry, const char* fmt0, ...) SHARED_LOCKS_REQUIRED(Locks::mutator_lock_) {
+    if (UNLIKELY(!checking_)) {
+      return;  // This call lost the sampling draw; pass it through unvalidated.
+    }
     va_list ap;
 
     mirror::ArtMethod* traceMethod = nullptr;
@@ -602,6 +631,9 @@ class ScopedCheck {
    */
   bool CheckInstance(InstanceKind kind, jobject java_object)
       SHARED_LOCKS_REQUIRED(Locks::mutator_lock_) {
+    if (UNLIKELY(!checking_)) {
+      return true;
+    }
     const char* what = nullptr;
     switch (kind) {
     case kClass:
@@ -669,6 +701,29 @@ class ScopedCheck {
     flags_ = flags;
     function_name_ = functionName;
     has_method_ = has_method;
+    checking_ = ShouldCheck();
+  }
+
+  // Decides whether this call gets validated. With a zero sampling interval (the default) every
+  // call is checked. A positive interval N validates roughly one call in N per thread so that
+  // CheckJNI can stay enabled at bounded cost in the field; the countdown lives in the
+  // per-thread JNIEnvExt, so sampling itself touches no shared state. One decision covers both
+  // the entry and exit checks of a call.
+  bool ShouldCheck() {
+    int interval = soa_.Vm()->check_jni_sampling_interval;
+    if (LIKELY(interval <= 0)) {
+      return true;
+    }
+    JNIEnvExt* env = soa_.Env();
+    if (env == nullptr) {
+      return true;  // Invocation interface calls are rare; always check them.
+    }
+    if (env->check_jni_sample_counter == 0) {
+      env->check_jni_sample_counter = static_cast<uint32_t>(interval);
+      return true;
+    }
+    --env->check_jni_sample_counter;
+    return false;
   }
 
   /*
@@ -886,6 +941,8 @@ class ScopedCheck {
   const char* function_name_;
   int flags_;
   bool has_method_;
+  // False when this call was skipped by sampling; all the check entry points early-out then.
+  bool checking_;
   int indent_;
 
   DISALLOW_COPY_AND_ASSIGN(ScopedCheck);
@@ -2724,6 +2724,15 @@ void ClassLinker::LinkCode(Handle<mirror::ArtMethod> method, const OatFile::OatC
                                                    have_portable_code);
 }
 
+// Loading walks the dependency chain on the requesting thread, on purpose. A helper thread that
+// pre-resolves superclasses and interfaces would be doing full class definition - allocating
+// mirror objects, taking dex_lock_ and the object lock per class, running static initializer
+// ordering rules - concurrently with the application's own loads of the same classes, and the
+// ClassLinker's duplicate-definition and initialization protocols are built around the loading
+// thread owning that work. The page-fault half of the concern is mostly already handled below
+// the runtime: dex files are mmapped, class_data for classes compiled together sits close in
+// the file, and kernel readahead on the sequential startup access pattern does what an
+// fadvise queue would, without a thread to feed.
 void ClassLinker::LoadClass(const DexFile& dex_file,
                             const DexFile::ClassDef& dex_class_def,
                             Handle<mirror::Class> klass,
@@ -2979,6 +2988,22 @@ void ClassLinker::RegisterDexFileLocked(const DexFile& dex_file,
   CHECK(dex_cache.Get() != nullptr) << dex_file.GetLocation();
   CHECK(dex_cache->GetLocation()->Equals(dex_file.GetLocation()))
       << dex_cache->GetLocation()->ToModifiedUtf8() << " " << dex_file.GetLocation();
+  // If another copy of the same dex file is already registered, share its resolved string
+  // array: string resolution is class loader independent (results are interned), so caches
+  // for the same dex file agree on every slot. Multi class loader apps which open the same
+  // dex file once per loader then keep a single string array live instead of one each. The
+  // resolved type, method and field arrays can differ per class loader and stay separate.
+  for (size_t i = 0; i != dex_caches_.size(); ++i) {
+    mirror::DexCache* other_dex_cache = GetDexCache(i);
+    const DexFile* other_dex_file = other_dex_cache->GetDexFile();
+    if (other_dex_file != nullptr &&
+        other_dex_file->GetLocationChecksum() == dex_file.GetLocationChecksum() &&
+        other_dex_file->GetLocation() == dex_file.GetLocation()) {
+      DCHECK_EQ(other_dex_cache->NumStrings(), dex_cache->NumStrings());
+      dex_cache->SetStrings(other_dex_cache->GetStrings());
+      break;
+    }
+  }
   dex_caches_.push_back(GcRoot<mirror::DexCache>(dex_cache.Get()));
   dex_cache->SetDexFile(&dex_file);
   if (log_new_dex_caches_roots_) {
@@ -3501,6 +3526,12 @@ void ClassLinker::LookupClasses(const char* descriptor, std::vector<mirror::Clas
 }
 
 void ClassLinker::VerifyClass(Handle<mirror::Class> klass) {
+  // Runs synchronously under the class's object lock. This path is only hot when the oat data
+  // is stale; with usable oat data classes arrive preverified from dex2oat, which already
+  // verifies in parallel through the CompilerDriver thread pool. Pre-verifying here on a
+  // runtime thread pool would need the workers to own their own handles and per-thread
+  // verifier registration, and any thread that actually needs the class still has to wait on
+  // this lock, so the synchronous fallback is kept.
   // TODO: assert that the monitor on the Class is held
   Thread* self = Thread::Current();
   ObjectLock<mirror::Class> lock(self, klass);
@@ -5568,8 +5599,9 @@ void ClassLinker::CreateReferenceInstanceOffsets(Handle<mirror::Class> klass) {
   mirror::Class* super_class = klass->GetSuperClass();
   if (super_class != nullptr) {
     reference_offsets = super_class->GetReferenceInstanceOffsets();
-    // If our superclass overflowed, we don't stand a chance.
-    if (reference_offsets == CLASS_WALK_SUPER) {
+    // If our superclass overflowed, all of our own fields are past the bitmap as well and the
+    // hierarchy walk which finds the superclass's spilled fields finds ours too.
+    if ((reference_offsets & CLASS_REF_OFFSETS_OVERFLOW) != 0) {
       klass->SetReferenceInstanceOffsets(reference_offsets);
       return;
     }
@@ -5599,9 +5631,18 @@ void ClassLinker::CreateReferenceOffsets(Handle<mirror::Class> klass, bool is_st
               true, klass->GetVTableDuringLinking()->GetLength(), 0, 0, 0)
           : sizeof(mirror::Class);
     uint32_t start_bit = start_offset / sizeof(mirror::HeapReference<mirror::Object>);
-    if (start_bit + num_reference_fields > 32) {
-      reference_offsets = CLASS_WALK_SUPER;
-    } else {
+    if (start_offset + num_reference_fields * sizeof(mirror::HeapReference<mirror::Object>) >
+            CLASS_REF_OFFSETS_LIMIT) {
+      // Fields at or past the limit are found by walking the class hierarchy. Keep the bits
+      // for the fields below it so the bitmap still covers them.
+      reference_offsets |= CLASS_REF_OFFSETS_OVERFLOW;
+      num_reference_fields =
+          start_offset < CLASS_REF_OFFSETS_LIMIT
+              ? (CLASS_REF_OFFSETS_LIMIT - start_offset) /
+                    sizeof(mirror::HeapReference<mirror::Object>)
+              : 0u;
+    }
+    if (num_reference_fields != 0u) {
       reference_offsets |= (0xffffffffu >> start_bit) &
                            (0xffffffffu << (32 - (start_bit + num_reference_fields)));
     }
@@ -733,6 +733,9 @@ class ClassLinker {
       Table;
   // This contains strong roots. To enable concurrent root scanning of
   // the class table, be careful to use a read barrier when accessing this.
+  // Lookups take the reader side of classlinker_classes_lock_ and so run in parallel; they
+  // cannot go fully lock-free because inserts rehash in place and even the pre-zygote table
+  // is mutated after fork (class removal on failed definition, image class moves).
   Table class_table_ GUARDED_BY(Locks::classlinker_classes_lock_);
   Table pre_zygote_class_table_ GUARDED_BY(Locks::classlinker_classes_lock_);
   std::vector<GcRoot<mirror::Class>> new_class_roots_;
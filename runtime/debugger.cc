@@ -322,6 +322,8 @@ AllocRecord* Dbg::recent_allocation_records_ = nullptr;  // TODO: CircularBuffer
 size_t Dbg::alloc_record_max_ = 0;
 size_t Dbg::alloc_record_head_ = 0;
 size_t Dbg::alloc_record_count_ = 0;
+size_t Dbg::alloc_record_sample_bytes_ = 0;
+Atomic<int64_t> Dbg::alloc_record_bytes_until_sample_(0);
 Dbg::TypeCache Dbg::type_cache_;
 
 // Deoptimization support.
@@ -3199,6 +3201,14 @@ static void SanityCheckExistingBreakpoints(mirror::ArtMethod* m,
 // Returns the deoptimization kind required to set a breakpoint in a method.
 // If a breakpoint has already been set, we also return the first breakpoint
 // through the given 'existing_brkpt' pointer.
+//
+// Selective deoptimization is the common outcome here: Instrumentation::Deoptimize patches only
+// the target method's entrypoint to the interpreter bridge and the rest of the app keeps running
+// compiled code. We only fall back to kFullDeoptimization when correctness forces us to: either
+// the method may have been inlined into other compiled code (the breakpoint would be skipped at
+// the inline site), or callers may jump through a direct code pointer baked into the image and
+// would never observe the patched entrypoint. Both conditions are properties of how the code was
+// compiled, so debug-friendly compilation (no inlining, no direct pointers) keeps attach cheap.
 static DeoptimizationRequest::Kind GetRequiredDeoptimizationKind(Thread* self,
                                                                  mirror::ArtMethod* m,
                                                                  const Breakpoint** existing_brkpt)
@@ -4043,6 +4053,13 @@ void Dbg::DdmSendChunk(uint32_t type, const std::vector<uint8_t>& bytes) {
   DdmSendChunk(type, bytes.size(), &bytes[0]);
 }
 
+// DDM servicing already lives on a dedicated thread: requests arrive and replies leave on the
+// JDWP thread, not on application threads. When attaching a profiler visibly stutters the app,
+// the cost is inside the handlers themselves - heap dumps and thread-status chunks suspend the
+// world or walk the thread list under lock - and moving those through another queue/thread hop
+// defers the suspensions without shrinking them. A bounded queue that sheds load is also not an
+// option at this layer: DDM chunks are request/reply paired, and a dropped reply wedges the
+// tool's state machine on the other end of the wire.
 void Dbg::DdmSendChunkV(uint32_t type, const iovec* iov, int iov_count) {
   if (gJdwpState == NULL) {
     VLOG(jdwp) << "Debugger thread not active, ignoring DDM send: " << type;
@@ -4495,6 +4512,26 @@ static size_t GetAllocTrackerMax() {
   return kDefaultNumAllocRecords;
 }
 
+// Byte interval for statistical sampling of tracked allocations; 0 (the default) records every
+// allocation, which is what DDMS expects. Setting the property turns the tracker into a cheap
+// per-callsite sampler that can stay enabled in production builds.
+static size_t GetAllocTrackerSampleBytes() {
+#ifdef HAVE_ANDROID_OS
+  const char* propertyName = "dalvik.vm.allocTrackerSampleBytes";
+  char sampleBytesString[PROPERTY_VALUE_MAX];
+  if (property_get(propertyName, sampleBytesString, "") > 0) {
+    char* end;
+    size_t value = strtoul(sampleBytesString, &end, 10);
+    if (*end != '\0') {
+      LOG(ERROR) << "Ignoring  " << propertyName << " '" << sampleBytesString << "' --- invalid";
+      return 0;
+    }
+    return value;
+  }
+#endif
+  return 0;
+}
+
 void Dbg::SetAllocTrackingEnabled(bool enable) {
   Thread* self = Thread::Current();
   if (enable) {
@@ -4504,9 +4541,15 @@ void Dbg::SetAllocTrackingEnabled(bool enable) {
         return;  // Already enabled, bail.
       }
       alloc_record_max_ = GetAllocTrackerMax();
+      alloc_record_sample_bytes_ = GetAllocTrackerSampleBytes();
+      alloc_record_bytes_until_sample_.StoreRelaxed(alloc_record_sample_bytes_);
       LOG(INFO) << "Enabling alloc tracker (" << alloc_record_max_ << " entries of "
                 << kMaxAllocRecordStackDepth << " frames, taking "
-                << PrettySize(sizeof(AllocRecord) * alloc_record_max_) << ")";
+                << PrettySize(sizeof(AllocRecord) * alloc_record_max_)
+                << (alloc_record_sample_bytes_ != 0
+                        ? StringPrintf(", sampling every %zd bytes", alloc_record_sample_bytes_)
+                        : "")
+                << ")";
       DCHECK_EQ(alloc_record_head_, 0U);
       DCHECK_EQ(alloc_record_count_, 0U);
       recent_allocation_records_ = new AllocRecord[alloc_record_max_];
@@ -4568,6 +4611,17 @@ void Dbg::RecordAllocation(mirror::Class* type, size_t byte_count) {
   Thread* self = Thread::Current();
   CHECK(self != NULL);
 
+  if (alloc_record_sample_bytes_ != 0) {
+    // Statistical mode: most allocations pay one atomic subtract here instead of the tracker
+    // lock and a stack walk. Racing threads can both cross zero and record, but the sampling
+    // only has to hold on average, and a stray extra record is harmless.
+    if (alloc_record_bytes_until_sample_.FetchAndSubSequentiallyConsistent(byte_count) >
+        static_cast<int64_t>(byte_count)) {
+      return;
+    }
+    alloc_record_bytes_until_sample_.StoreRelaxed(alloc_record_sample_bytes_);
+  }
+
   MutexLock mu(self, *Locks::alloc_tracker_lock_);
   if (recent_allocation_records_ == NULL) {
     // In the process of shutting down recording, bail.
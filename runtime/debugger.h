@@ -28,6 +28,7 @@
 #include <string>
 #include <vector>
 
+#include "atomic.h"
 #include "gc_root.h"
 #include "jdwp/jdwp.h"
 #include "jni.h"
@@ -678,6 +679,11 @@ class Dbg {
   static size_t alloc_record_max_ GUARDED_BY(Locks::alloc_tracker_lock_);
   static size_t alloc_record_head_ GUARDED_BY(Locks::alloc_tracker_lock_);
   static size_t alloc_record_count_ GUARDED_BY(Locks::alloc_tracker_lock_);
+  // Statistical sampling: when non-zero, only one allocation per roughly this many allocated
+  // bytes takes the tracker lock and walks the stack; the rest pay a single atomic subtract.
+  // Written only while the tracker is being enabled, read on every tracked allocation.
+  static size_t alloc_record_sample_bytes_;
+  static Atomic<int64_t> alloc_record_bytes_until_sample_;
 
   static ObjectRegistry* gRegistry;
 
@@ -212,6 +212,13 @@ const DexFile* DexFile::OpenFile(int fd, const char* location, bool verify,
     return nullptr;
   }
 
+  // This full scan (adler32 plus structural checks) touches every page of the map and is the
+  // expensive part of a raw dex open. It is intentionally not skippable via a "verified once"
+  // side marker: an xattr or similar lives in the same trust domain as the file contents, so
+  // anything able to tamper with the dex could forge the marker too. The fast path exists at a
+  // different level -- once dex2oat has run, processes open the dex embedded in the oat file
+  // (OatDexFile::OpenDexFile), which does no verifier pass and faults pages in on demand; this
+  // code is only the one-time cost paid before an oat file exists.
   if (verify && !DexFileVerifier::Verify(dex_file, dex_file->Begin(), dex_file->Size(), location,
                                          error_msg)) {
     return nullptr;
@@ -419,6 +426,13 @@ uint32_t DexFile::GetVersion() const {
   return atoi(version);
 }
 
+// A hash index over the class defs is built in memory below once a dex file has absorbed enough
+// failed lookups -- and misses are the expensive, common case, since ClassLinker probes every dex
+// file on the classpath before resolving a class. Baking the index into the oat file next to
+// class_offsets_ would only save that one-time O(num_class_defs) build, at the price of an oat
+// version bump and a table whose layout (bucket count, probe scheme, string hash) becomes a
+// cross-version compiler/runtime contract. If profiles show the pre-index binary searches
+// themselves hurting, lowering kMaxFailedDexClassDefLookups is the cheap knob to try first.
 const DexFile::ClassDef* DexFile::FindClassDef(const char* descriptor, size_t hash) const {
   DCHECK_EQ(ComputeModifiedUtf8Hash(descriptor), hash);
   // If we have an index lookup the descriptor via that as its constant time to search.
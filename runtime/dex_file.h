@@ -312,6 +312,11 @@ class DexFile {
     kDexAnnotationValueArgShift = 5,
   };
 
+  // Annotation layout structs. The runtime only defines the on-disk shapes; all annotation
+  // decoding (getAnnotation and friends) happens in libcore's managed AnnotationAccess, which
+  // reads the dex through com.android.dex. Any per-class annotation-type index or memoization
+  // therefore belongs on that side of the fence, next to the code that streams the
+  // encoded_annotation ULEB data.
   struct AnnotationsDirectoryItem {
     uint32_t class_annotations_off_;
     uint32_t fields_size_;
@@ -2079,6 +2079,14 @@ bool DexFileVerifier::CheckInterSection() {
   return true;
 }
 
+// The four phases below are deliberately sequential and single-threaded. The intra-section walk
+// is a streaming parse: items are ULEB128-delimited, so the position of item N is only known
+// after walking item N-1, which rules out splitting a section across threads, and the walk's
+// by-product - offset_to_type_map_ - is exactly what CheckInterSection consumes, so the phases
+// can't overlap either. Fanning sections out across a thread pool would also drag a worker pool
+// into DexFile::Open, which runs on app threads at install/first-load time. The effective fix
+// for slow installs is avoiding re-verification: a dex embedded in a valid oat file is not
+// verified again at load, so this cost is paid once per dex, in dex2oat.
 bool DexFileVerifier::Verify() {
   // Check the header.
   if (!CheckHeader()) {
@@ -32,6 +32,13 @@ enum {
   kNumPackedOpcodes = 0x100
 };
 
+// Decoding is deliberately stateless: each accessor is a shift/mask over the raw code units and
+// the per-opcode properties are single indexed loads from the tables below. There is no shared
+// "predecoded method" form on purpose -- the consumers that re-decode (verifier and MIR builder
+// in dex2oat, interpreter in the app process) run in different phases and mostly different
+// processes, so a shared decoded array would have to be serialized into the oat file and would
+// just be a fatter re-encoding of what the dex bytecode already is. Consumers that want a
+// decoded struct build their own (see DecodedInstruction in the MIR graph).
 class Instruction {
  public:
   // NOP-encoded switch-statement signatures.
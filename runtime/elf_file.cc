@@ -783,6 +783,12 @@ const byte* ElfFile::FindDynamicSymbolAddress(const std::string& symbol_name) co
 }
 
 // WARNING: Only called from FindDynamicSymbolAddress. Elides check for hash section.
+// This is the only symbol lookup on the oat loading path, and it is already hashed: ElfWriter
+// emits a SysV .hash section which this consults, never the linear scan in FindSymbolByName
+// (that one serves symtab queries from tooling). The dynamic table of an oat ELF holds just the
+// handful of oat* symbols, so a .gnu.hash with bloom filters would shave nothing measurable off
+// an open - the per-launch cost of opening many oat files lives in the mapping and checksum
+// work, not here. FindSymbolByName's build_map path exists for repeated tooling queries.
 const Elf32_Sym* ElfFile::FindDynamicSymbol(const std::string& symbol_name) const {
   if (GetHashBucketNum() == 0) {
     // No dynamic symbols at all.
@@ -237,6 +237,13 @@ JValue InvokeProxyInvocationHandler(ScopedObjectAccessAlreadyRunnable& soa, cons
   DCHECK(soa.Env()->IsInstanceOf(rcvr_jobj, WellKnownClasses::java_lang_reflect_Proxy));
 
   // Build argument array possibly triggering GC.
+  //
+  // The boxing below is imposed by the InvocationHandler.invoke ABI: the handler receives a real
+  // Object[], so a flattened primitive buffer with on-demand boxing would need a different
+  // handler-side contract in libcore, which the runtime cannot impose unilaterally. What we can
+  // do is keep the boxing cheap: BoxPrimitive dispatches through the wrapper valueOf methods, so
+  // booleans, bytes, chars and small integers come from the preallocated caches without touching
+  // the allocator at all.
   soa.Self()->AssertThreadSuspensionIsAllowable();
   jobjectArray args_jobj = NULL;
   const JValue zero;
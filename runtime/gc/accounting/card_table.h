@@ -44,6 +44,14 @@ template<size_t kAlignment> class SpaceBitmap;
 // Maintain a card table from the the write barrier. All writes of
 // non-NULL values to heap addresses should go through an entry in
 // WriteBarrier, and from there to here.
+//
+// The table is deliberately single-level. A summary bitmap over card groups only pays if it is
+// kept up to date by the dirtying side, and dirtying is a three-instruction sequence inlined
+// into every compiled reference store plus the C++ barriers -- growing that path taxes mutators
+// to speed a scan that is already cheap: the table is heap_size / kCardSize bytes (a few
+// hundred KB for our heaps), Scan() consumes clean cards a 16-card chunk per load, and the
+// whole thing reads sequentially at memory bandwidth. Summary maintenance at scan time instead
+// would mean reading every card byte anyway, which is exactly the work being avoided.
 class CardTable {
  public:
   static constexpr size_t kCardShift = 7;
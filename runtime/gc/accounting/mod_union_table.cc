@@ -285,8 +285,14 @@ void ModUnionTableReferenceCache::UpdateAndMarkReferences(MarkHeapReferenceCallb
         continue;
       }
       references_.Put(card, cards_references);
+    } else if (cards_references.empty()) {
+      // The card no longer references the alloc space(s), drop the entry so that later
+      // collections don't keep revisiting it.
+      references_.erase(found);
     } else {
-      found->second = cards_references;
+      // Swap instead of copy, this also donates the old vector's capacity for reuse by the
+      // next card.
+      found->second.swap(cards_references);
     }
   }
   cleared_cards_.clear();
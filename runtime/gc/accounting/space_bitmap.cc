@@ -94,6 +94,26 @@ void SpaceBitmap<kAlignment>::Clear() {
   }
 }
 
+template<size_t kAlignment>
+void SpaceBitmap<kAlignment>::ClearRange(const mirror::Object* begin, const mirror::Object* end) {
+  uintptr_t begin_offset = reinterpret_cast<uintptr_t>(begin) - heap_begin_;
+  uintptr_t end_offset = reinterpret_cast<uintptr_t>(end) - heap_begin_;
+  // Clear the bits of any partial word at the start of the range.
+  while (begin_offset < end_offset && (begin_offset / kAlignment) % kBitsPerWord != 0) {
+    Clear(reinterpret_cast<mirror::Object*>(heap_begin_ + begin_offset));
+    begin_offset += kAlignment;
+  }
+  // Clear the bits of any partial word at the end of the range.
+  while (begin_offset < end_offset && (end_offset / kAlignment) % kBitsPerWord != 0) {
+    end_offset -= kAlignment;
+    Clear(reinterpret_cast<mirror::Object*>(heap_begin_ + end_offset));
+  }
+  const uintptr_t start_index = OffsetToIndex(begin_offset);
+  const uintptr_t end_index = OffsetToIndex(end_offset);
+  memset(reinterpret_cast<void*>(&bitmap_begin_[start_index]), 0,
+         (end_index - start_index) * kWordSize);
+}
+
 template<size_t kAlignment>
 void SpaceBitmap<kAlignment>::CopyFrom(SpaceBitmap* source_bitmap) {
   DCHECK_EQ(Size(), source_bitmap->Size());
@@ -86,6 +86,11 @@ class SpaceBitmap {
   // Fill the bitmap with zeroes.  Returns the bitmap's memory to the system as a side-effect.
   void Clear();
 
+  // Clear the bits corresponding to objects in [begin, end). Unlike Clear(), this zeroes the
+  // words with memset instead of returning the pages to the kernel, so a collector which
+  // re-touches the bitmap right away doesn't take a soft page fault per bitmap page.
+  void ClearRange(const mirror::Object* begin, const mirror::Object* end);
+
   bool Test(const mirror::Object* obj) const;
 
   // Return true iff <obj> is within the range of pointers that this bitmap could potentially cover,
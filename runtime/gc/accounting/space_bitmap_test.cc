@@ -157,6 +157,35 @@ void RunTest() NO_THREAD_SAFETY_ANALYSIS {
   }
 }
 
+TEST_F(SpaceBitmapTest, ClearRange) {
+  byte* heap_begin = reinterpret_cast<byte*>(0x10000000);
+  size_t heap_capacity = 16 * MB;
+  std::unique_ptr<ContinuousSpaceBitmap> bitmap(
+      ContinuousSpaceBitmap::Create("test bitmap", heap_begin, heap_capacity));
+  EXPECT_TRUE(bitmap.get() != nullptr);
+  // Set all of the bits, clear ranges with both word-aligned and unaligned edges and check
+  // that exactly the bits in the range were cleared.
+  const std::pair<uintptr_t, uintptr_t> ranges[] = {
+      {0, 10 * kObjectAlignment},
+      {kObjectAlignment, kObjectAlignment * kBitsPerWord},
+      {kObjectAlignment * (kBitsPerWord - 1), kObjectAlignment * (3 * kBitsPerWord + 5)},
+      {0, heap_capacity},
+  };
+  for (const auto& range : ranges) {
+    for (uintptr_t offset = 0; offset < heap_capacity; offset += kObjectAlignment) {
+      bitmap->Set(reinterpret_cast<mirror::Object*>(heap_begin + offset));
+    }
+    mirror::Object* const begin = reinterpret_cast<mirror::Object*>(heap_begin + range.first);
+    mirror::Object* const end = reinterpret_cast<mirror::Object*>(heap_begin + range.second);
+    bitmap->ClearRange(begin, end);
+    for (uintptr_t offset = 0; offset < heap_capacity; offset += kObjectAlignment) {
+      mirror::Object* const obj = reinterpret_cast<mirror::Object*>(heap_begin + offset);
+      EXPECT_EQ(bitmap->Test(obj), offset < range.first || offset >= range.second);
+    }
+    bitmap->Clear();
+  }
+}
+
 TEST_F(SpaceBitmapTest, VisitorObjectAlignment) {
   RunTest<kObjectAlignment>();
 }
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ART_RUNTIME_GC_ACCOUNTING_WORK_STEALING_DEQUE_H_
+#define ART_RUNTIME_GC_ACCOUNTING_WORK_STEALING_DEQUE_H_
+
+#include <memory>
+#include <string>
+
+#include "atomic.h"
+#include "base/logging.h"
+#include "base/macros.h"
+#include "mem_map.h"
+#include "utils.h"
+
+namespace art {
+namespace gc {
+namespace accounting {
+
+// A fixed-size Chase-Lev work-stealing deque. The owner thread pushes and pops work at the
+// bottom without synchronization in the common case, thieves steal from the top with a CAS.
+// Used by the parallel mark phase so that idle GC workers can steal gray objects from busy
+// ones instead of waiting for statically partitioned chunks to finish.
+//
+// PushBottom/PopBottom may only be called by the owning thread, Steal may be called by any
+// thread. On overflow PushBottom returns false and the caller is expected to spill to a
+// shared overflow stack.
+template <typename T>
+class WorkStealingDeque {
+ public:
+  // Capacity is how many elements we can store in the deque, must be a power of two.
+  static WorkStealingDeque* Create(const std::string& name, size_t capacity) {
+    CHECK(IsPowerOfTwo(capacity)) << capacity;
+    std::unique_ptr<WorkStealingDeque> deque(new WorkStealingDeque(name, capacity));
+    deque->Init();
+    return deque.release();
+  }
+
+  ~WorkStealingDeque() {}
+
+  void Reset() {
+    DCHECK(mem_map_.get() != nullptr);
+    DCHECK(begin_ != nullptr);
+    top_.StoreRelaxed(0);
+    bottom_.StoreRelaxed(0);
+  }
+
+  // Push an element onto the bottom of the deque. Owner thread only. Returns false if the
+  // deque is full.
+  bool PushBottom(const T& value) {
+    const int32_t bottom = bottom_.LoadRelaxed();
+    const int32_t top = top_.LoadSequentiallyConsistent();
+    if (UNLIKELY(bottom - top >= static_cast<int32_t>(capacity_))) {
+      return false;  // Deque overflow, caller must spill elsewhere.
+    }
+    begin_[bottom & mask_] = value;
+    // The element must be visible before the new bottom index.
+    bottom_.StoreSequentiallyConsistent(bottom + 1);
+    return true;
+  }
+
+  // Pop an element from the bottom of the deque. Owner thread only. Returns false if the
+  // deque is empty.
+  bool PopBottom(T* out_value) {
+    DCHECK(out_value != nullptr);
+    int32_t bottom = bottom_.LoadRelaxed() - 1;
+    bottom_.StoreSequentiallyConsistent(bottom);
+    int32_t top = top_.LoadSequentiallyConsistent();
+    if (top <= bottom) {
+      // Non-empty, common case.
+      *out_value = begin_[bottom & mask_];
+      if (top == bottom) {
+        // This was the last element, race against thieves for it.
+        if (!top_.CompareExchangeStrongSequentiallyConsistent(top, top + 1)) {
+          // A thief won the race.
+          bottom_.StoreRelaxed(bottom + 1);
+          return false;
+        }
+        bottom_.StoreRelaxed(bottom + 1);
+      }
+      return true;
+    }
+    // Already empty, restore the bottom index.
+    bottom_.StoreRelaxed(bottom + 1);
+    return false;
+  }
+
+  // Steal an element from the top of the deque. Safe to call from any thread. Returns false
+  // if the deque is empty or if we lost a race against the owner or another thief.
+  bool Steal(T* out_value) {
+    DCHECK(out_value != nullptr);
+    const int32_t top = top_.LoadSequentiallyConsistent();
+    const int32_t bottom = bottom_.LoadSequentiallyConsistent();
+    if (top >= bottom) {
+      return false;  // Empty.
+    }
+    *out_value = begin_[top & mask_];
+    // The CAS fails if the owner popped the element or another thief stole it first.
+    return top_.CompareExchangeStrongSequentiallyConsistent(top, top + 1);
+  }
+
+  bool IsEmpty() const {
+    return Size() == 0;
+  }
+
+  // Approximate size, only exact when called by the owner with no concurrent thieves.
+  size_t Size() const {
+    const int32_t size = bottom_.LoadRelaxed() - top_.LoadRelaxed();
+    return size > 0 ? static_cast<size_t>(size) : 0U;
+  }
+
+  size_t Capacity() const {
+    return capacity_;
+  }
+
+ private:
+  WorkStealingDeque(const std::string& name, size_t capacity)
+      : name_(name),
+        top_(0),
+        bottom_(0),
+        begin_(nullptr),
+        capacity_(capacity),
+        mask_(capacity - 1) {
+  }
+
+  // Size in number of elements.
+  void Init() {
+    std::string error_msg;
+    mem_map_.reset(MemMap::MapAnonymous(name_.c_str(), NULL, capacity_ * sizeof(T),
+                                        PROT_READ | PROT_WRITE, false, &error_msg));
+    CHECK(mem_map_.get() != NULL) << "couldn't allocate work stealing deque.\n" << error_msg;
+    byte* addr = mem_map_->Begin();
+    CHECK(addr != NULL);
+    begin_ = reinterpret_cast<T*>(addr);
+    Reset();
+  }
+
+  // Name of the deque.
+  std::string name_;
+  // Memory mapping of the deque.
+  std::unique_ptr<MemMap> mem_map_;
+  // Top index, thieves steal from here with a CAS.
+  AtomicInteger top_;
+  // Bottom index, only written by the owner thread.
+  AtomicInteger bottom_;
+  // Base of the circular buffer.
+  T* begin_;
+  // Maximum number of elements, power of two.
+  size_t capacity_;
+  // capacity_ - 1, used for wrapping indices into the circular buffer.
+  size_t mask_;
+
+  DISALLOW_COPY_AND_ASSIGN(WorkStealingDeque);
+};
+
+typedef WorkStealingDeque<mirror::Object*> ObjectWorkStealingDeque;
+
+}  // namespace accounting
+}  // namespace gc
+}  // namespace art
+
+#endif  // ART_RUNTIME_GC_ACCOUNTING_WORK_STEALING_DEQUE_H_
@@ -22,6 +22,7 @@
 #include "thread_list.h"
 #include "rosalloc.h"
 
+#include <algorithm>
 #include <map>
 #include <list>
 #include <vector>
@@ -1156,12 +1157,10 @@ size_t RosAlloc::BulkFree(Thread* self, void** ptrs, size_t num_ptrs) {
   WriterMutexLock wmu(self, bulk_free_lock_);
 
   // First mark slots to free in the bulk free bit map without locking the
-  // size bracket locks. On host, unordered_set is faster than vector + flag.
-#ifdef HAVE_ANDROID_OS
+  // size bracket locks. The affected runs are deduplicated with the
+  // to_be_bulk_freed_ flag and kept in a vector so that they can be sorted by
+  // size bracket below.
   std::vector<Run*> runs;
-#else
-  std::unordered_set<Run*, hash_run, eq_run> runs;
-#endif
   for (size_t i = 0; i < num_ptrs; i++) {
     void* ptr = ptrs[i];
     DCHECK_LE(base_, ptr);
@@ -1224,27 +1223,33 @@ size_t RosAlloc::BulkFree(Thread* self, void** ptrs, size_t num_ptrs) {
     DCHECK_EQ(run->magic_num_, kMagicNum);
     // Set the bit in the bulk free bit map.
     freed_bytes += run->MarkBulkFreeBitMap(ptr);
-#ifdef HAVE_ANDROID_OS
     if (!run->to_be_bulk_freed_) {
       run->to_be_bulk_freed_ = true;
       runs.push_back(run);
     }
-#else
-    runs.insert(run);
-#endif
   }
 
   // Now, iterate over the affected runs and update the alloc bit map
   // based on the bulk free bit map (for non-thread-local runs) and
   // union the bulk free bit map into the thread-local free bit map
-  // (for thread-local runs.)
+  // (for thread-local runs.) Process the runs in size bracket order so that
+  // each size bracket lock is acquired once per group of runs in that bracket
+  // rather than once per run.
+  std::sort(runs.begin(), runs.end(), [](Run* lhs, Run* rhs) {
+    return lhs->size_bracket_idx_ < rhs->size_bracket_idx_;
+  });
+  size_t locked_idx = kNumOfSizeBrackets;  // Invalid index, no bracket lock is held.
   for (Run* run : runs) {
-#ifdef HAVE_ANDROID_OS
     DCHECK(run->to_be_bulk_freed_);
     run->to_be_bulk_freed_ = false;
-#endif
     size_t idx = run->size_bracket_idx_;
-    MutexLock mu(self, *size_bracket_locks_[idx]);
+    if (idx != locked_idx) {
+      if (locked_idx != kNumOfSizeBrackets) {
+        size_bracket_locks_[locked_idx]->ExclusiveUnlock(self);
+      }
+      size_bracket_locks_[idx]->ExclusiveLock(self);
+      locked_idx = idx;
+    }
     if (run->IsThreadLocal()) {
       DCHECK_LT(run->size_bracket_idx_, kNumThreadLocalSizeBrackets);
       DCHECK(non_full_runs_[idx].find(run) == non_full_runs_[idx].end());
@@ -1343,6 +1348,9 @@ size_t RosAlloc::BulkFree(Thread* self, void** ptrs, size_t num_ptrs) {
       }
     }
   }
+  if (locked_idx != kNumOfSizeBrackets) {
+    size_bracket_locks_[locked_idx]->ExclusiveUnlock(self);
+  }
   return freed_bytes;
 }
 
@@ -2165,22 +2173,32 @@ size_t RosAlloc::ReleasePageRange(byte* start, byte* end) {
     // contains a magic number for debugging. Exclude it.
     start += kPageSize;
   }
-  if (!kMadviseZeroes) {
-    // TODO: Do this when we resurrect the page instead.
-    memset(start, 0, end - start);
-  }
-  CHECK_EQ(madvise(start, end - start, MADV_DONTNEED), 0);
   size_t pm_idx = ToPageMapIndex(start);
   size_t reclaimed_bytes = 0;
-  // Calculate reclaimed bytes and upate page map.
   const size_t max_idx = pm_idx + (end - start) / kPageSize;
-  for (; pm_idx < max_idx; ++pm_idx) {
+  // Madvise only the maximal sub-ranges of pages which haven't been released yet. A long-lived
+  // free page run stays in the page map across trims, so without this every trim reissues the
+  // same madvise calls for pages the kernel has already reclaimed.
+  while (pm_idx < max_idx) {
     DCHECK(IsFreePage(pm_idx));
-    if (page_map_[pm_idx] == kPageMapEmpty) {
+    if (page_map_[pm_idx] == kPageMapReleased) {
+      ++pm_idx;
+      continue;
+    }
+    const size_t range_begin_idx = pm_idx;
+    while (pm_idx < max_idx && page_map_[pm_idx] == kPageMapEmpty) {
       // Mark the page as released and update how many bytes we released.
-      reclaimed_bytes += kPageSize;
       page_map_[pm_idx] = kPageMapReleased;
+      ++pm_idx;
+    }
+    byte* const range_begin = base_ + range_begin_idx * kPageSize;
+    const size_t range_size = (pm_idx - range_begin_idx) * kPageSize;
+    if (!kMadviseZeroes) {
+      // TODO: Do this when we resurrect the page instead.
+      memset(range_begin, 0, range_size);
     }
+    CHECK_EQ(madvise(range_begin, range_size, MADV_DONTNEED), 0);
+    reclaimed_bytes += range_size;
   }
   return reclaimed_bytes;
 }
@@ -403,7 +403,11 @@ class RosAlloc {
 
   // We use thread-local runs for the size Brackets whose indexes
   // are less than this index. We use shared (current) runs for the rest.
-  static const size_t kNumThreadLocalSizeBrackets = 8;
+  // All brackets (up to the 2 KB maximum) are thread-local. A thread
+  // only acquires a run for a bracket when it first allocates in it
+  // (until then it stays on the dedicated full run), so idle brackets
+  // cost nothing per thread.
+  static const size_t kNumThreadLocalSizeBrackets = kNumOfSizeBrackets;
 
  private:
   // The base address of the memory region that's managed by this allocator.
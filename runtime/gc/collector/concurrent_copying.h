@@ -23,6 +23,9 @@ namespace art {
 namespace gc {
 namespace collector {
 
+// Not implemented: RunPhases() is a stub. A real concurrent copying collector needs read
+// barriers in the mirror:: accessors and in compiled code, which this runtime does not have;
+// parsed_options.cc falls back to CMS if -Xgc:CC is requested.
 class ConcurrentCopying : public GarbageCollector {
  public:
   explicit ConcurrentCopying(Heap* heap, bool generational = false,
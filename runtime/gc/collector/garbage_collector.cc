@@ -16,6 +16,8 @@
 
 #include <stdio.h>
 
+#include <algorithm>
+
 #include "garbage_collector.h"
 
 #include "base/histogram-inl.h"
@@ -136,6 +138,11 @@ uint64_t GarbageCollector::GetEstimatedMeanThroughput() const {
   return (total_freed_bytes_ * 1000) / (NsToMs(GetCumulativeTimings().GetTotalNs()) + 1);
 }
 
+uint64_t GarbageCollector::GetEstimatedMeanDurationNs() const {
+  // Guard against division by 0 when no iteration has completed yet.
+  return total_time_ns_ / std::max(NumberOfIterations(), static_cast<size_t>(1));
+}
+
 void GarbageCollector::ResetMeasurements() {
   cumulative_timings_.Reset();
   pause_histogram_.Reset();
@@ -160,6 +160,8 @@ class GarbageCollector {
   void ResetMeasurements();
   // Returns the estimated throughput in bytes / second.
   uint64_t GetEstimatedMeanThroughput() const;
+  // Returns the estimated duration of one collection in nanoseconds.
+  uint64_t GetEstimatedMeanDurationNs() const;
   // Returns how many GC iterations have been run.
   size_t NumberOfIterations() const {
     return GetCumulativeTimings().GetIterations();
@@ -16,6 +16,10 @@
 
 #include "mark_compact.h"
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 #include "base/logging.h"
 #include "base/mutex-inl.h"
 #include "base/timing_logger.h"
@@ -48,6 +52,7 @@
 #include "stack.h"
 #include "thread-inl.h"
 #include "thread_list.h"
+#include "thread_pool.h"
 
 using ::art::mirror::Object;
 
@@ -55,6 +60,14 @@ namespace art {
 namespace gc {
 namespace collector {
 
+// If true and the heap has a GC thread pool, compute forwarding addresses in parallel by
+// partitioning the space into blocks, summing per-block live bytes on the pool, and installing
+// the forwarding addresses per block from the resulting prefix sums.
+static constexpr bool kParallelForwardingAddresses = true;
+// Size of the blocks which the space is partitioned into. An object belongs to the block which
+// contains its start address.
+static constexpr size_t kForwardingBlockSize = 1 * MB;
+
 void MarkCompact::BindBitmaps() {
   TimingLogger::ScopedTiming t(__FUNCTION__, GetTimings());
   WriterMutexLock mu(Thread::Current(), *Locks::heap_bitmap_lock_);
@@ -117,15 +130,163 @@ class CalculateObjectForwardingAddressVisitor {
   MarkCompact* const collector_;
 };
 
+class SumLiveBytesVisitor {
+ public:
+  explicit SumLiveBytesVisitor(size_t* live_bytes) : live_bytes_(live_bytes) {}
+
+  void operator()(mirror::Object* obj) const ALWAYS_INLINE NO_THREAD_SAFETY_ANALYSIS {
+    DCHECK_ALIGNED(obj, space::BumpPointerSpace::kAlignment);
+    *live_bytes_ += RoundUp(obj->SizeOf(), space::BumpPointerSpace::kAlignment);
+  }
+
+ private:
+  size_t* const live_bytes_;
+};
+
+// Sums the live bytes of the marked objects which start in one block of the space.
+class SumLiveBytesTask : public Task {
+ public:
+  SumLiveBytesTask(accounting::ContinuousSpaceBitmap* bitmap, uintptr_t begin, uintptr_t end)
+      : bitmap_(bitmap), begin_(begin), end_(end), live_bytes_(0) {}
+
+  void Run(Thread* self) OVERRIDE NO_THREAD_SAFETY_ANALYSIS {
+    UNUSED(self);
+    SumLiveBytesVisitor visitor(&live_bytes_);
+    bitmap_->VisitMarkedRange(begin_, end_, visitor);
+  }
+
+  size_t GetLiveBytes() const {
+    return live_bytes_;
+  }
+
+ private:
+  accounting::ContinuousSpaceBitmap* const bitmap_;
+  const uintptr_t begin_;
+  const uintptr_t end_;
+  size_t live_bytes_;
+};
+
+class ForwardBlockVisitor {
+ public:
+  ForwardBlockVisitor(accounting::ContinuousSpaceBitmap* objects_with_lockword,
+                      byte** bump_pointer, std::vector<LockWord>* lock_words,
+                      size_t* live_objects)
+      : objects_with_lockword_(objects_with_lockword), bump_pointer_(bump_pointer),
+        lock_words_(lock_words), live_objects_(live_objects) {}
+
+  void operator()(mirror::Object* obj) const ALWAYS_INLINE NO_THREAD_SAFETY_ANALYSIS {
+    DCHECK_ALIGNED(obj, space::BumpPointerSpace::kAlignment);
+    const size_t alloc_size = RoundUp(obj->SizeOf(), space::BumpPointerSpace::kAlignment);
+    LockWord lock_word = obj->GetLockWord(false);
+    // If we have a non empty lock word, store it and restore it later.
+    if (lock_word.GetValue() != LockWord().GetValue()) {
+      // Set the bit in the bitmap so that we know to restore it later. This is safe without
+      // atomics since the blocks are aligned to a multiple of the bitmap word coverage, so no
+      // bitmap word is shared between two tasks.
+      objects_with_lockword_->Set(obj);
+      lock_words_->push_back(lock_word);
+    }
+    obj->SetLockWord(LockWord::FromForwardingAddress(reinterpret_cast<size_t>(*bump_pointer_)),
+                     false);
+    *bump_pointer_ += alloc_size;
+    ++*live_objects_;
+  }
+
+ private:
+  accounting::ContinuousSpaceBitmap* const objects_with_lockword_;
+  byte** const bump_pointer_;
+  std::vector<LockWord>* const lock_words_;
+  size_t* const live_objects_;
+};
+
+// Installs the forwarding addresses for the marked objects which start in one block, given the
+// block's destination start address from the prefix sum over the block live bytes. The saved
+// lock words are collected per block and appended to lock_words_to_restore_ in block order
+// afterwards so that they stay in address order for MoveObjects.
+class ForwardBlockTask : public Task {
+ public:
+  ForwardBlockTask(accounting::ContinuousSpaceBitmap* bitmap,
+                   accounting::ContinuousSpaceBitmap* objects_with_lockword,
+                   uintptr_t begin, uintptr_t end, byte* dest, size_t expected_live_bytes)
+      : bitmap_(bitmap), objects_with_lockword_(objects_with_lockword), begin_(begin),
+        end_(end), dest_(dest), expected_live_bytes_(expected_live_bytes), live_objects_(0) {}
+
+  void Run(Thread* self) OVERRIDE NO_THREAD_SAFETY_ANALYSIS {
+    UNUSED(self);
+    byte* bump_pointer = dest_;
+    ForwardBlockVisitor visitor(objects_with_lockword_, &bump_pointer, &lock_words_,
+                                &live_objects_);
+    bitmap_->VisitMarkedRange(begin_, end_, visitor);
+    DCHECK_EQ(static_cast<size_t>(bump_pointer - dest_), expected_live_bytes_);
+  }
+
+  size_t GetLiveObjects() const {
+    return live_objects_;
+  }
+
+  const std::vector<LockWord>& GetLockWords() const {
+    return lock_words_;
+  }
+
+ private:
+  accounting::ContinuousSpaceBitmap* const bitmap_;
+  accounting::ContinuousSpaceBitmap* const objects_with_lockword_;
+  const uintptr_t begin_;
+  const uintptr_t end_;
+  byte* const dest_;
+  const size_t expected_live_bytes_;
+  size_t live_objects_;
+  std::vector<LockWord> lock_words_;
+};
+
 void MarkCompact::CalculateObjectForwardingAddresses() {
   TimingLogger::ScopedTiming t(__FUNCTION__, GetTimings());
   // The bump pointer in the space where the next forwarding address will be.
   bump_pointer_ = reinterpret_cast<byte*>(space_->Begin());
-  // Visit all the marked objects in the bitmap.
-  CalculateObjectForwardingAddressVisitor visitor(this);
-  objects_before_forwarding_->VisitMarkedRange(reinterpret_cast<uintptr_t>(space_->Begin()),
-                                               reinterpret_cast<uintptr_t>(space_->End()),
-                                               visitor);
+  const uintptr_t space_begin = reinterpret_cast<uintptr_t>(space_->Begin());
+  const uintptr_t space_end = reinterpret_cast<uintptr_t>(space_->End());
+  ThreadPool* thread_pool = heap_->GetThreadPool();
+  if (kParallelForwardingAddresses && thread_pool != nullptr &&
+      space_end - space_begin > kForwardingBlockSize) {
+    Thread* self = Thread::Current();
+    const size_t num_blocks =
+        RoundUp(space_end - space_begin, kForwardingBlockSize) / kForwardingBlockSize;
+    // First pass: sum the live bytes of each block in parallel.
+    std::vector<std::unique_ptr<SumLiveBytesTask>> sum_tasks;
+    for (size_t i = 0; i < num_blocks; ++i) {
+      const uintptr_t begin = space_begin + i * kForwardingBlockSize;
+      const uintptr_t end = std::min(space_end, begin + kForwardingBlockSize);
+      sum_tasks.emplace_back(new SumLiveBytesTask(objects_before_forwarding_.get(), begin, end));
+      thread_pool->AddTask(self, sum_tasks.back().get());
+    }
+    thread_pool->StartWorkers(self);
+    thread_pool->Wait(self, true, true);
+    // Second pass: install forwarding addresses per block, with each block's destination start
+    // address computed as the prefix sum of the block live bytes.
+    std::vector<std::unique_ptr<ForwardBlockTask>> forward_tasks;
+    for (size_t i = 0; i < num_blocks; ++i) {
+      const uintptr_t begin = space_begin + i * kForwardingBlockSize;
+      const uintptr_t end = std::min(space_end, begin + kForwardingBlockSize);
+      const size_t live_bytes = sum_tasks[i]->GetLiveBytes();
+      forward_tasks.emplace_back(new ForwardBlockTask(objects_before_forwarding_.get(),
+                                                      objects_with_lockword_.get(), begin, end,
+                                                      bump_pointer_, live_bytes));
+      thread_pool->AddTask(self, forward_tasks.back().get());
+      bump_pointer_ += live_bytes;
+    }
+    thread_pool->Wait(self, true, true);
+    thread_pool->StopWorkers(self);
+    // Stitch the per-block results back together in block order.
+    for (const auto& task : forward_tasks) {
+      live_objects_in_space_ += task->GetLiveObjects();
+      lock_words_to_restore_.insert(lock_words_to_restore_.end(), task->GetLockWords().begin(),
+                                    task->GetLockWords().end());
+    }
+  } else {
+    // Visit all the marked objects in the bitmap.
+    CalculateObjectForwardingAddressVisitor visitor(this);
+    objects_before_forwarding_->VisitMarkedRange(space_begin, space_end, visitor);
+  }
 }
 
 void MarkCompact::InitializePhase() {
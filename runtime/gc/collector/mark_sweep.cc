@@ -25,11 +25,13 @@
 #include "base/logging.h"
 #include "base/macros.h"
 #include "base/mutex-inl.h"
+#include "base/stl_util.h"
 #include "base/timing_logger.h"
 #include "gc/accounting/card_table-inl.h"
 #include "gc/accounting/heap_bitmap-inl.h"
 #include "gc/accounting/mod_union_table.h"
 #include "gc/accounting/space_bitmap-inl.h"
+#include "gc/accounting/work_stealing_deque.h"
 #include "gc/heap.h"
 #include "gc/reference_processor.h"
 #include "gc/space/image_space.h"
@@ -52,6 +54,13 @@ namespace collector {
 // Performance options.
 static constexpr bool kUseRecursiveMark = false;
 static constexpr bool kUseMarkStackPrefetch = true;
+// Pop the mark stack in batches, prefetch the object headers and then the class objects
+// before visiting, instead of the single object lookahead of the bounded fifo. Marking is
+// memory latency bound, the batch gives the prefetches time to complete.
+static constexpr bool kUseMarkStackBatchedPrefetch = true;
+// Batch size for the software pipelined traversal. Large enough to cover the prefetch
+// latency, small enough that the batch stays resident in L1.
+static constexpr size_t kMarkStackBatchSize = 16;
 static constexpr size_t kSweepArrayChunkFreeSize = 1024;
 static constexpr bool kPreCleanCards = true;
 
@@ -64,6 +73,14 @@ static constexpr bool kParallelRecursiveMark = true;
 // ProcessMarkStack with very small mark stacks.
 static constexpr size_t kMinimumParallelMarkStackSize = 128;
 static constexpr bool kParallelProcessMarkStack = true;
+// Use per-worker Chase-Lev deques when processing the mark stack in parallel so that idle
+// workers steal gray objects from busy ones instead of waiting on statically sized chunks.
+// This keeps all the workers busy when one chunk hits a deep object graph.
+static constexpr bool kUseMarkStackWorkStealing = true;
+// Capacity of each worker's deque, in objects. Overflow spills to the shared mark stack.
+static constexpr size_t kWorkStealingDequeCapacity = 16 * KB;
+// How many objects a worker refills from the shared mark stack per lock acquisition.
+static constexpr size_t kWorkStealingRefillSize = 64;
 
 // Profiling and information flags.
 static constexpr bool kProfileLargeObjects = false;
@@ -108,6 +125,10 @@ MarkSweep::MarkSweep(Heap* heap, bool is_concurrent, const std::string& name_pre
   sweep_array_free_buffer_mem_map_.reset(mem_map);
 }
 
+MarkSweep::~MarkSweep() {
+  STLDeleteElements(&mark_deques_);
+}
+
 void MarkSweep::InitializePhase() {
   TimingLogger::ScopedTiming t(__FUNCTION__, GetTimings());
   mark_stack_ = heap_->GetMarkStack();
@@ -214,7 +235,7 @@ void MarkSweep::PreCleanCards() {
     Thread* self = Thread::Current();
     CHECK(!Locks::mutator_lock_->IsExclusiveHeld(self));
     // Process dirty cards and add dirty cards to mod union tables, also ages cards.
-    heap_->ProcessCards(GetTimings(), false);
+    heap_->ProcessCards(GetTimings(), false, GetAgedCards());
     // The checkpoint root marking is required to avoid a race condition which occurs if the
     // following happens during a reference write:
     // 1. mutator dirties the card (write barrier)
@@ -252,7 +273,7 @@ void MarkSweep::MarkingPhase() {
   BindBitmaps();
   FindDefaultSpaceBitmap();
   // Process dirty cards and add dirty cards to mod union tables.
-  heap_->ProcessCards(GetTimings(), false);
+  heap_->ProcessCards(GetTimings(), false, GetAgedCards());
   WriterMutexLock mu(self, *Locks::heap_bitmap_lock_);
   MarkRoots(self);
   MarkReachableObjects();
@@ -427,6 +448,25 @@ inline void MarkSweep::PushOnMarkStack(Object* obj) {
   mark_stack_->PushBack(obj);
 }
 
+void MarkSweep::PushOnMarkStackParallel(Object* obj) {
+  DCHECK(obj != nullptr);
+  MutexLock mu(Thread::Current(), mark_stack_lock_);
+  if (UNLIKELY(mark_stack_->Size() >= mark_stack_->Capacity())) {
+    ExpandMarkStack();
+  }
+  mark_stack_->PushBack(obj);
+}
+
+size_t MarkSweep::PopMarkStackBatchParallel(Object** buffer, size_t max_count) {
+  DCHECK(buffer != nullptr);
+  MutexLock mu(Thread::Current(), mark_stack_lock_);
+  const size_t count = std::min(max_count, mark_stack_->Size());
+  Object** end = mark_stack_->End();
+  std::copy(end - count, end, buffer);
+  mark_stack_->PopBackCount(static_cast<int32_t>(count));
+  return count;
+}
+
 inline bool MarkSweep::MarkObjectParallel(const Object* obj) {
   DCHECK(obj != nullptr);
   if (kUseBakerOrBrooksReadBarrier) {
@@ -460,6 +500,26 @@ void MarkSweep::MarkRootParallelCallback(Object** root, void* arg, const RootInf
   reinterpret_cast<MarkSweep*>(arg)->MarkObjectNonNullParallel(*root);
 }
 
+void MarkSweep::MarkRootParallelBufferedCallback(Object** root, void* arg,
+                                                 const RootInfo& /*root_info*/) {
+  reinterpret_cast<MarkSweep::MarkBuffer*>(arg)->MarkObject(*root);
+}
+
+void MarkSweep::MarkBuffer::Flush() {
+  if (pos_ == 0) {
+    return;
+  }
+  MarkSweep* const mark_sweep = mark_sweep_;
+  MutexLock mu(Thread::Current(), mark_sweep->mark_stack_lock_);
+  for (size_t i = 0; i < pos_; ++i) {
+    if (UNLIKELY(mark_sweep->mark_stack_->Size() >= mark_sweep->mark_stack_->Capacity())) {
+      mark_sweep->ExpandMarkStack();
+    }
+    mark_sweep->mark_stack_->PushBack(buffer_[i]);
+  }
+  pos_ = 0;
+}
+
 void MarkSweep::VerifyRootMarked(Object** root, void* arg, const RootInfo& /*root_info*/) {
   CHECK(reinterpret_cast<MarkSweep*>(arg)->IsMarked(*root));
 }
@@ -648,6 +708,28 @@ class MarkStackTask : public Task {
   virtual void Run(Thread* self) SHARED_LOCKS_REQUIRED(Locks::mutator_lock_)
       EXCLUSIVE_LOCKS_REQUIRED(Locks::heap_bitmap_lock_) {
     ScanObjectParallelVisitor visitor(this);
+    if (kUseMarkStackBatchedPrefetch) {
+      Object* batch[kMarkStackBatchSize];
+      while (mark_stack_pos_ != 0) {
+        size_t count = 0;
+        while (count < kMarkStackBatchSize && mark_stack_pos_ != 0) {
+          batch[count++] = mark_stack_[--mark_stack_pos_];
+        }
+        // Stage 1: the object headers, including the class pointer word.
+        for (size_t i = 0; i < count; ++i) {
+          __builtin_prefetch(batch[i]);
+        }
+        // Stage 2: the class objects. The headers prefetched above have usually arrived by
+        // the time the dependent class pointer load issues.
+        for (size_t i = 0; i < count; ++i) {
+          __builtin_prefetch(batch[i]->GetClass<kVerifyNone>());
+        }
+        for (size_t i = 0; i < count; ++i) {
+          visitor(batch[i]);
+        }
+      }
+      return;
+    }
     // TODO: Tune this.
     static const size_t kFifoSize = 4;
     BoundedFifoPowerOfTwo<Object*, kFifoSize> prefetch_fifo;
@@ -677,6 +759,138 @@ class MarkStackTask : public Task {
   }
 };
 
+// A mark stack processing task which owns one Chase-Lev work stealing deque of gray objects.
+// Each task drains its own deque, refills in bulk from the shared mark stack when the deque
+// runs dry, and steals from the other workers' deques when the shared stack is empty too.
+// Deque overflow spills back to the shared mark stack. The tasks exit once no worker is
+// scanning and no gray objects remain anywhere.
+class MarkStealTask : public Task {
+ public:
+  MarkStealTask(MarkSweep* mark_sweep, size_t index, size_t thread_count)
+      : mark_sweep_(mark_sweep),
+        index_(index),
+        thread_count_(thread_count),
+        deque_(nullptr) {
+    if (kCountTasks) {
+      ++mark_sweep_->work_chunks_created_;
+    }
+  }
+
+  virtual ~MarkStealTask() {
+    if (kCountTasks) {
+      ++mark_sweep_->work_chunks_deleted_;
+    }
+  }
+
+ protected:
+  class MarkObjectStealVisitor {
+   public:
+    explicit MarkObjectStealVisitor(MarkStealTask* task) ALWAYS_INLINE : task_(task) {}
+
+    void operator()(Object* obj, MemberOffset offset, bool /* static */) const ALWAYS_INLINE
+        SHARED_LOCKS_REQUIRED(Locks::mutator_lock_) {
+      mirror::Object* ref = obj->GetFieldObject<mirror::Object>(offset);
+      if (ref != nullptr && task_->mark_sweep_->MarkObjectParallel(ref)) {
+        if (UNLIKELY(!task_->deque_->PushBottom(ref))) {
+          // Deque overflow, spill to the shared mark stack where any worker can refill.
+          task_->mark_sweep_->PushOnMarkStackParallel(ref);
+        }
+      }
+    }
+
+   private:
+    MarkStealTask* const task_;
+  };
+
+  virtual void Finalize() {
+    delete this;
+  }
+
+  virtual void Run(Thread* self) NO_THREAD_SAFETY_ANALYSIS {
+    MarkSweep* const mark_sweep = mark_sweep_;
+    deque_ = mark_sweep->mark_deques_[index_];
+    MarkObjectStealVisitor mark_visitor(this);
+    DelayReferenceReferentVisitor ref_visitor(mark_sweep);
+    // Count ourselves as a scanner until we first run out of work.
+    mark_sweep->active_mark_workers_.FetchAndAddSequentiallyConsistent(1);
+    for (;;) {
+      Object* obj;
+      while (FindWork(&obj)) {
+        mark_sweep->ScanObjectVisit(obj, mark_visitor, ref_visitor);
+      }
+      // No work anywhere, go idle. All our deque pushes happen before this decrement, so
+      // once every worker has decremented, any remaining work is visible to WorkAvailable.
+      mark_sweep->active_mark_workers_.FetchAndSubSequentiallyConsistent(1);
+      bool done = false;
+      while (true) {
+        if (WorkAvailable()) {
+          break;
+        }
+        if (mark_sweep->active_mark_workers_.LoadSequentiallyConsistent() == 0 &&
+            !WorkAvailable()) {
+          // No worker is scanning and there are no gray objects left, we are finished.
+          done = true;
+          break;
+        }
+        sched_yield();
+      }
+      if (done) {
+        break;
+      }
+      mark_sweep->active_mark_workers_.FetchAndAddSequentiallyConsistent(1);
+    }
+    DCHECK(deque_->IsEmpty());
+  }
+
+ private:
+  // Attempt to acquire a gray object: our own deque first, then a bulk refill from the
+  // shared mark stack, then stealing from the other workers' deques.
+  bool FindWork(Object** out_obj) {
+    if (deque_->PopBottom(out_obj)) {
+      return true;
+    }
+    Object* buffer[kWorkStealingRefillSize];
+    const size_t count = mark_sweep_->PopMarkStackBatchParallel(buffer, arraysize(buffer));
+    if (count != 0) {
+      // The deque was just empty and the refill is much smaller than its capacity.
+      for (size_t i = 1; i < count; ++i) {
+        bool success = deque_->PushBottom(buffer[i]);
+        DCHECK(success);
+      }
+      *out_obj = buffer[0];
+      return true;
+    }
+    // Steal from the other workers, starting with our right hand neighbor to spread the
+    // thieves across victims.
+    for (size_t i = 1; i < thread_count_; ++i) {
+      if (mark_sweep_->mark_deques_[(index_ + i) % thread_count_]->Steal(out_obj)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Racy check for visible work, used while idle. A false positive only costs a failed
+  // FindWork round trip.
+  bool WorkAvailable() const {
+    if (!mark_sweep_->mark_stack_->IsEmpty()) {
+      return true;
+    }
+    for (size_t i = 0; i < thread_count_; ++i) {
+      if (!mark_sweep_->mark_deques_[i]->IsEmpty()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  MarkSweep* const mark_sweep_;
+  // Which deque in MarkSweep::mark_deques_ this task owns.
+  const size_t index_;
+  const size_t thread_count_;
+  accounting::ObjectWorkStealingDeque* deque_;
+};
+
 class CardScanTask : public MarkStackTask<false> {
  public:
   CardScanTask(ThreadPool* thread_pool, MarkSweep* mark_sweep,
@@ -961,7 +1175,11 @@ class CheckpointMarkThreadRoots : public Closure {
     Thread* self = Thread::Current();
     CHECK(thread == self || thread->IsSuspended() || thread->GetState() == kWaitingPerformingGc)
         << thread->GetState() << " thread " << thread << " self " << self;
-    thread->VisitRoots(MarkSweep::MarkRootParallelCallback, mark_sweep_);
+    // Buffer the newly marked roots and flush them to the shared mark stack in blocks rather
+    // than bouncing mark_stack_lock_ between the checkpointed threads per root.
+    MarkSweep::MarkBuffer mark_buffer(mark_sweep_);
+    thread->VisitRoots(MarkSweep::MarkRootParallelBufferedCallback, &mark_buffer);
+    mark_buffer.Flush();
     ATRACE_END();
     if (revoke_ros_alloc_thread_local_buffers_at_checkpoint_) {
       ATRACE_BEGIN("RevokeRosAllocThreadLocalBuffers");
@@ -1166,14 +1384,28 @@ void MarkSweep::ProcessMarkStackCallback(void* arg) {
 void MarkSweep::ProcessMarkStackParallel(size_t thread_count) {
   Thread* self = Thread::Current();
   ThreadPool* thread_pool = GetHeap()->GetThreadPool();
-  const size_t chunk_size = std::min(mark_stack_->Size() / thread_count + 1,
-                                     static_cast<size_t>(MarkStackTask<false>::kMaxSize));
-  CHECK_GT(chunk_size, 0U);
-  // Split the current mark stack up into work tasks.
-  for (mirror::Object **it = mark_stack_->Begin(), **end = mark_stack_->End(); it < end; ) {
-    const size_t delta = std::min(static_cast<size_t>(end - it), chunk_size);
-    thread_pool->AddTask(self, new MarkStackTask<false>(thread_pool, this, delta, it));
-    it += delta;
+  if (kUseMarkStackWorkStealing) {
+    // Lazily create one deque per worker, reused across collections.
+    while (mark_deques_.size() < thread_count) {
+      mark_deques_.push_back(accounting::ObjectWorkStealingDeque::Create(
+          "mark sweep work stealing deque", kWorkStealingDequeCapacity));
+    }
+    active_mark_workers_.StoreRelaxed(0);
+    // The workers pull their initial work from the shared mark stack and fan out through
+    // their deques from there.
+    for (size_t i = 0; i < thread_count; ++i) {
+      thread_pool->AddTask(self, new MarkStealTask(this, i, thread_count));
+    }
+  } else {
+    const size_t chunk_size = std::min(mark_stack_->Size() / thread_count + 1,
+                                       static_cast<size_t>(MarkStackTask<false>::kMaxSize));
+    CHECK_GT(chunk_size, 0U);
+    // Split the current mark stack up into work tasks.
+    for (mirror::Object **it = mark_stack_->Begin(), **end = mark_stack_->End(); it < end; ) {
+      const size_t delta = std::min(static_cast<size_t>(end - it), chunk_size);
+      thread_pool->AddTask(self, new MarkStackTask<false>(thread_pool, this, delta, it));
+      it += delta;
+    }
   }
   thread_pool->SetMaxActiveWorkers(thread_count - 1);
   thread_pool->StartWorkers(self);
@@ -1192,6 +1424,25 @@ void MarkSweep::ProcessMarkStack(bool paused) {
   if (kParallelProcessMarkStack && thread_count > 1 &&
       mark_stack_->Size() >= kMinimumParallelMarkStackSize) {
     ProcessMarkStackParallel(thread_count);
+  } else if (kUseMarkStackBatchedPrefetch) {
+    // Software pipelined traversal: pop a batch, prefetch the object headers, then the class
+    // objects, then visit. See the comment on kUseMarkStackBatchedPrefetch.
+    Object* batch[kMarkStackBatchSize];
+    while (!mark_stack_->IsEmpty()) {
+      size_t count = 0;
+      while (count < kMarkStackBatchSize && !mark_stack_->IsEmpty()) {
+        batch[count++] = mark_stack_->PopBack();
+      }
+      for (size_t i = 0; i < count; ++i) {
+        __builtin_prefetch(batch[i]);
+      }
+      for (size_t i = 0; i < count; ++i) {
+        __builtin_prefetch(batch[i]->GetClass<kVerifyNone>());
+      }
+      for (size_t i = 0; i < count; ++i) {
+        ScanObject(batch[i]);
+      }
+    }
   } else {
     // TODO: Tune this.
     static const size_t kFifoSize = 4;
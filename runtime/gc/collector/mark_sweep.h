@@ -18,6 +18,7 @@
 #define ART_RUNTIME_GC_COLLECTOR_MARK_SWEEP_H_
 
 #include <memory>
+#include <vector>
 
 #include "atomic.h"
 #include "barrier.h"
@@ -48,6 +49,8 @@ class Heap;
 namespace accounting {
   template<typename T> class AtomicStack;
   typedef AtomicStack<mirror::Object*> ObjectStack;
+  template<typename T> class WorkStealingDeque;
+  typedef WorkStealingDeque<mirror::Object*> ObjectWorkStealingDeque;
 }  // namespace accounting
 
 namespace collector {
@@ -56,7 +59,7 @@ class MarkSweep : public GarbageCollector {
  public:
   explicit MarkSweep(Heap* heap, bool is_concurrent, const std::string& name_prefix = "");
 
-  ~MarkSweep() {}
+  ~MarkSweep();
 
   virtual void RunPhases() OVERRIDE NO_THREAD_SAFETY_ANALYSIS;
   void InitializePhase();
@@ -207,6 +210,44 @@ class MarkSweep : public GarbageCollector {
     return *gc_barrier_;
   }
 
+  // Per worker buffer of objects marked through the parallel path. Newly marked objects are
+  // collected locally and flushed to the shared mark stack in blocks, instead of taking
+  // mark_stack_lock_ once per object. The buffer must be flushed before it goes out of scope.
+  class MarkBuffer {
+   public:
+    explicit MarkBuffer(MarkSweep* mark_sweep) : mark_sweep_(mark_sweep), pos_(0) {}
+
+    ~MarkBuffer() {
+      DCHECK_EQ(pos_, 0U) << "Mark buffer not flushed";
+    }
+
+    // Mark an object atomically and buffer it if it was not already marked.
+    void MarkObject(mirror::Object* obj) ALWAYS_INLINE {
+      DCHECK(obj != nullptr);
+      if (mark_sweep_->MarkObjectParallel(obj)) {
+        buffer_[pos_++] = obj;
+        if (UNLIKELY(pos_ == kSize)) {
+          Flush();
+        }
+      }
+    }
+
+    // Push the buffered objects onto the shared mark stack with a single lock acquisition.
+    void Flush() LOCKS_EXCLUDED(mark_stack_lock_);
+
+   private:
+    static constexpr size_t kSize = 64;
+
+    MarkSweep* const mark_sweep_;
+    size_t pos_;
+    mirror::Object* buffer_[kSize];
+  };
+
+  // Version of MarkRootParallelCallback which marks into a MarkBuffer passed as arg.
+  static void MarkRootParallelBufferedCallback(mirror::Object** root, void* arg,
+                                               const RootInfo& root_info)
+      SHARED_LOCKS_REQUIRED(Locks::mutator_lock_);
+
   // Schedules an unmarked object for reference processing.
   void DelayReferenceReferent(mirror::Class* klass, mirror::Reference* reference)
       SHARED_LOCKS_REQUIRED(Locks::heap_bitmap_lock_, Locks::mutator_lock_);
@@ -252,11 +293,27 @@ class MarkSweep : public GarbageCollector {
   // Push a single reference on a mark stack.
   void PushOnMarkStack(mirror::Object* obj);
 
+  // Push a single reference on the shared mark stack, holding mark_stack_lock_. Used by GC
+  // workers to spill gray objects when their work stealing deque overflows.
+  void PushOnMarkStackParallel(mirror::Object* obj) LOCKS_EXCLUDED(mark_stack_lock_);
+
+  // Pop up to max_count references from the shared mark stack into buffer, holding
+  // mark_stack_lock_. Returns how many references were popped.
+  size_t PopMarkStackBatchParallel(mirror::Object** buffer, size_t max_count)
+      LOCKS_EXCLUDED(mark_stack_lock_);
+
   // Blackens objects grayed during a garbage collection.
-  void ScanGrayObjects(bool paused, byte minimum_age)
+  virtual void ScanGrayObjects(bool paused, byte minimum_age)
       EXCLUSIVE_LOCKS_REQUIRED(Locks::heap_bitmap_lock_)
       SHARED_LOCKS_REQUIRED(Locks::mutator_lock_);
 
+  // Card set which ProcessCards records aged alloc space cards into, so that a sticky
+  // collection can scan exactly those cards instead of the whole card table. Null for
+  // collections which do not need it.
+  virtual std::vector<byte*>* GetAgedCards() {
+    return nullptr;
+  }
+
   // Recursively blackens objects on the mark stack.
   void ProcessMarkStack(bool paused)
       EXCLUSIVE_LOCKS_REQUIRED(Locks::heap_bitmap_lock_)
@@ -287,6 +344,15 @@ class MarkSweep : public GarbageCollector {
   // Immune region, every object inside the immune range is assumed to be marked.
   ImmuneRegion immune_region_;
 
+  // Per GC worker Chase-Lev deques of gray objects, used when processing the mark stack in
+  // parallel so that idle workers can steal work from busy ones. Lazily created, one per
+  // worker thread, reused across collections.
+  std::vector<accounting::ObjectWorkStealingDeque*> mark_deques_;
+  // Number of GC workers currently scanning objects, used for termination detection when
+  // processing the mark stack with work stealing. New gray objects can only be produced
+  // while this is non zero.
+  AtomicInteger active_mark_workers_;
+
   // Parallel finger.
   AtomicInteger atomic_finger_;
   // Number of classes scanned, if kCountScannedTypes.
@@ -331,6 +397,7 @@ class MarkSweep : public GarbageCollector {
   friend class ModUnionTableReferenceCache;
   friend class ModUnionScanImageRootVisitor;
   template<bool kUseFinger> friend class MarkStackTask;
+  friend class MarkStealTask;
   friend class FifoMarkStackChunk;
   friend class MarkSweepMarkObjectSlowPath;
 
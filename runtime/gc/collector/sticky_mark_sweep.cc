@@ -14,9 +14,11 @@
  * limitations under the License.
  */
 
+#include "gc/accounting/card_table-inl.h"
+#include "gc/accounting/space_bitmap-inl.h"
 #include "gc/heap.h"
 #include "gc/space/large_object_space.h"
-#include "gc/space/space.h"
+#include "gc/space/space-inl.h"
 #include "sticky_mark_sweep.h"
 #include "thread-inl.h"
 
@@ -24,6 +26,10 @@ namespace art {
 namespace gc {
 namespace collector {
 
+// If true, scan only the cards recorded as aged by Heap::ProcessCards instead of walking the
+// card table of the whole alloc space.
+static constexpr bool kUseAgedCardSet = true;
+
 StickyMarkSweep::StickyMarkSweep(Heap* heap, bool is_concurrent, const std::string& name_prefix)
     : PartialMarkSweep(heap, is_concurrent,
                        name_prefix.empty() ? "sticky " : name_prefix) {
@@ -32,6 +38,9 @@ StickyMarkSweep::StickyMarkSweep(Heap* heap, bool is_concurrent, const std::stri
 
 void StickyMarkSweep::BindBitmaps() {
   PartialMarkSweep::BindBitmaps();
+  // Discard any cards recorded by an earlier collection, they may be stale if a space was
+  // removed since then. ProcessCards will record a fresh set for this collection.
+  aged_cards_.clear();
 
   WriterMutexLock mu(Thread::Current(), *Locks::heap_bitmap_lock_);
   // For sticky GC, we want to bind the bitmaps of all spaces as the allocation stack lets us
@@ -55,6 +64,66 @@ void StickyMarkSweep::MarkReachableObjects() {
   RecursiveMarkDirtyObjects(false, accounting::CardTable::kCardDirty - 1);
 }
 
+class StickyScanObjectVisitor {
+ public:
+  explicit StickyScanObjectVisitor(StickyMarkSweep* mark_sweep) ALWAYS_INLINE
+      : mark_sweep_(mark_sweep) {}
+
+  void operator()(mirror::Object* obj) const ALWAYS_INLINE
+      SHARED_LOCKS_REQUIRED(Locks::mutator_lock_)
+      EXCLUSIVE_LOCKS_REQUIRED(Locks::heap_bitmap_lock_) {
+    mark_sweep_->ScanObject(obj);
+  }
+
+ private:
+  StickyMarkSweep* const mark_sweep_;
+};
+
+void StickyMarkSweep::ScanGrayObjects(bool paused, byte minimum_age) {
+  if (!kUseAgedCardSet || paused || minimum_age != accounting::CardTable::kCardDirty - 1) {
+    MarkSweep::ScanGrayObjects(paused, minimum_age);
+    return;
+  }
+  TimingLogger::ScopedTiming t("ScanAgedCards", GetTimings());
+  accounting::CardTable* card_table = GetHeap()->GetCardTable();
+  StickyScanObjectVisitor visitor(this);
+  // Scan only the alloc space cards which ProcessCards aged from dirty. The cards were
+  // recorded in card table order, so the containing space rarely changes between iterations.
+  space::ContinuousSpace* space = nullptr;
+  accounting::ContinuousSpaceBitmap* bitmap = nullptr;
+  for (byte* const card : aged_cards_) {
+    const uintptr_t start = reinterpret_cast<uintptr_t>(card_table->AddrFromCard(card));
+    mirror::Object* const start_obj = reinterpret_cast<mirror::Object*>(start);
+    if (space == nullptr || !space->HasAddress(start_obj)) {
+      space = nullptr;
+      for (const auto& cur_space : GetHeap()->GetContinuousSpaces()) {
+        if (cur_space->HasAddress(start_obj)) {
+          space = cur_space;
+          break;
+        }
+      }
+      CHECK(space != nullptr) << "Aged card " << reinterpret_cast<void*>(card)
+          << " not in any continuous space";
+      bitmap = space->GetMarkBitmap();
+    }
+    if (bitmap != nullptr) {
+      bitmap->VisitMarkedRange(start, start + accounting::CardTable::kCardSize, visitor);
+    }
+  }
+  aged_cards_.clear();
+  // The immune spaces age their cards in their mod-union tables without recording them in the
+  // aged card set, scan those with the regular card table walk. They are small compared to the
+  // alloc spaces.
+  for (const auto& cur_space : GetHeap()->GetContinuousSpaces()) {
+    if (cur_space->GetMarkBitmap() != nullptr &&
+        (GetHeap()->FindModUnionTableFromSpace(cur_space) != nullptr ||
+         GetHeap()->FindRememberedSetFromSpace(cur_space) != nullptr)) {
+      card_table->Scan(cur_space->GetMarkBitmap(), cur_space->Begin(), cur_space->End(), visitor,
+                       minimum_age);
+    }
+  }
+}
+
 void StickyMarkSweep::Sweep(bool swap_bitmaps) {
   SweepArray(GetHeap()->GetLiveStack(), false);
 }
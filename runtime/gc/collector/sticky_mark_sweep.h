@@ -17,6 +17,8 @@
 #ifndef ART_RUNTIME_GC_COLLECTOR_STICKY_MARK_SWEEP_H_
 #define ART_RUNTIME_GC_COLLECTOR_STICKY_MARK_SWEEP_H_
 
+#include <vector>
+
 #include "base/macros.h"
 #include "partial_mark_sweep.h"
 
@@ -46,7 +48,22 @@ class StickyMarkSweep FINAL : public PartialMarkSweep {
       SHARED_LOCKS_REQUIRED(Locks::mutator_lock_)
       EXCLUSIVE_LOCKS_REQUIRED(Locks::heap_bitmap_lock_);
 
+  // Scan the aged card set recorded by Heap::ProcessCards for alloc spaces instead of
+  // walking the whole card table. Immune spaces still use the full range scan since their
+  // mod-union tables age cards without recording them.
+  void ScanGrayObjects(bool paused, byte minimum_age) OVERRIDE
+      EXCLUSIVE_LOCKS_REQUIRED(Locks::heap_bitmap_lock_)
+      SHARED_LOCKS_REQUIRED(Locks::mutator_lock_);
+
+  std::vector<byte*>* GetAgedCards() OVERRIDE {
+    return &aged_cards_;
+  }
+
  private:
+  // Alloc space cards aged from dirty by Heap::ProcessCards, in card table order. Acts as the
+  // remembered set of objects which may have been mutated since the last collection.
+  std::vector<byte*> aged_cards_;
+
   DISALLOW_COPY_AND_ASSIGN(StickyMarkSweep);
 };
 
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <iostream>
+#include <sstream>
+
+#include "base/histogram-inl.h"
+#include "common_runtime_test.h"
+#include "gc/heap.h"
+#include "handle_scope-inl.h"
+#include "mirror/class-inl.h"
+#include "mirror/object-inl.h"
+#include "mirror/object_array-inl.h"
+#include "scoped_thread_state_change.h"
+
+namespace art {
+namespace gc {
+
+// Benchmarks which run full collections against canned heap shapes and print wall time
+// distributions for them. These are not correctness tests; their point is to make collector
+// changes comparable without a full app run. Per phase timings and pause distributions come
+// from the collectors' own TimingLogger and Histogram data, dumped at the end of each
+// benchmark via DumpGcPerformanceInfo().
+
+static constexpr size_t kGcIterations = 10;
+// Depth of the complete binary tree of two element object arrays, ~64K nodes.
+static constexpr size_t kTreeDepth = 16;
+// Length of the singly linked list of two element object arrays.
+static constexpr size_t kListLength = 64 * 1024;
+// Number and size of the byte arrays which go to the large object space.
+static constexpr size_t kNumLargeArrays = 8;
+static constexpr size_t kLargeArrayBytes = 1 * MB;
+// Number and size of the small byte arrays used to fragment rosalloc runs.
+static constexpr size_t kNumSmallArrays = 32 * 1024;
+static constexpr size_t kSmallArrayBytes = 32;
+
+class GcBenchmarkTest : public CommonRuntimeTest {
+ protected:
+  mirror::Class* GetObjectArrayClass(Thread* self)
+      SHARED_LOCKS_REQUIRED(Locks::mutator_lock_) {
+    return class_linker_->FindSystemClass(self, "[Ljava/lang/Object;");
+  }
+
+  // Build a complete binary tree of two element object arrays of the given depth.
+  mirror::ObjectArray<mirror::Object>* AllocTree(Thread* self, Handle<mirror::Class> array_class,
+                                                 size_t depth)
+      SHARED_LOCKS_REQUIRED(Locks::mutator_lock_) {
+    StackHandleScope<2> hs(self);
+    Handle<mirror::ObjectArray<mirror::Object>> left(
+        hs.NewHandle(depth > 1 ? AllocTree(self, array_class, depth - 1) : nullptr));
+    Handle<mirror::ObjectArray<mirror::Object>> right(
+        hs.NewHandle(depth > 1 ? AllocTree(self, array_class, depth - 1) : nullptr));
+    mirror::ObjectArray<mirror::Object>* node =
+        mirror::ObjectArray<mirror::Object>::Alloc(self, array_class.Get(), 2);
+    CHECK(node != nullptr);
+    node->Set<false>(0, left.Get());
+    node->Set<false>(1, right.Get());
+    return node;
+  }
+
+  // Run kGcIterations full collections against whatever is currently live and print the wall
+  // time distribution. Called while runnable; CollectGarbage suspends as needed, the same as
+  // the allocator slow paths do.
+  void RunGc(const char* name) SHARED_LOCKS_REQUIRED(Locks::mutator_lock_) {
+    Heap* heap = Runtime::Current()->GetHeap();
+    Histogram<uint64_t> durations_us(name, 50);
+    for (size_t i = 0; i < kGcIterations; ++i) {
+      const uint64_t start = NanoTime();
+      heap->CollectGarbage(false);
+      durations_us.AddValue((NanoTime() - start) / 1000);
+    }
+    Histogram<uint64_t>::CumulativeData data;
+    durations_us.CreateHistogram(&data);
+    durations_us.PrintConfidenceIntervals(std::cout, 0.99, data);
+  }
+
+  // Dump the collectors' cumulative phase timings and pause histograms.
+  void DumpCollectorTimings() {
+    std::ostringstream oss;
+    Runtime::Current()->GetHeap()->DumpGcPerformanceInfo(oss);
+    std::cout << oss.str();
+  }
+};
+
+TEST_F(GcBenchmarkTest, BinaryTree) {
+  Thread* self = Thread::Current();
+  ScopedObjectAccess soa(self);
+  StackHandleScope<2> hs(self);
+  Handle<mirror::Class> array_class(hs.NewHandle(GetObjectArrayClass(self)));
+  Handle<mirror::ObjectArray<mirror::Object>> tree(
+      hs.NewHandle(AllocTree(self, array_class, kTreeDepth)));
+  RunGc("BinaryTreeGcTime");
+  DumpCollectorTimings();
+}
+
+TEST_F(GcBenchmarkTest, LinkedList) {
+  Thread* self = Thread::Current();
+  ScopedObjectAccess soa(self);
+  StackHandleScope<2> hs(self);
+  Handle<mirror::Class> array_class(hs.NewHandle(GetObjectArrayClass(self)));
+  // Build the list head first so a single handle keeps the whole chain alive. Deep chains are
+  // the worst case for the mark stack since each node only reveals one successor.
+  Handle<mirror::ObjectArray<mirror::Object>> head(
+      hs.NewHandle<mirror::ObjectArray<mirror::Object>>(nullptr));
+  for (size_t i = 0; i < kListLength; ++i) {
+    mirror::ObjectArray<mirror::Object>* node =
+        mirror::ObjectArray<mirror::Object>::Alloc(self, array_class.Get(), 2);
+    ASSERT_TRUE(node != nullptr);
+    node->Set<false>(0, head.Get());
+    head.Assign(node);
+  }
+  RunGc("LinkedListGcTime");
+  DumpCollectorTimings();
+}
+
+TEST_F(GcBenchmarkTest, LargeArrays) {
+  Thread* self = Thread::Current();
+  ScopedObjectAccess soa(self);
+  StackHandleScope<2> hs(self);
+  Handle<mirror::Class> array_class(hs.NewHandle(GetObjectArrayClass(self)));
+  Handle<mirror::ObjectArray<mirror::Object>> arrays(hs.NewHandle(
+      mirror::ObjectArray<mirror::Object>::Alloc(self, array_class.Get(), kNumLargeArrays)));
+  ASSERT_TRUE(arrays.Get() != nullptr);
+  for (size_t i = 0; i < kNumLargeArrays; ++i) {
+    mirror::ByteArray* array = mirror::ByteArray::Alloc(self, kLargeArrayBytes);
+    ASSERT_TRUE(array != nullptr);
+    arrays->Set<false>(i, array);
+  }
+  RunGc("LargeArraysGcTime");
+  DumpCollectorTimings();
+}
+
+TEST_F(GcBenchmarkTest, FragmentedRuns) {
+  Thread* self = Thread::Current();
+  ScopedObjectAccess soa(self);
+  StackHandleScope<2> hs(self);
+  Handle<mirror::Class> array_class(hs.NewHandle(GetObjectArrayClass(self)));
+  Handle<mirror::ObjectArray<mirror::Object>> arrays(hs.NewHandle(
+      mirror::ObjectArray<mirror::Object>::Alloc(self, array_class.Get(), kNumSmallArrays)));
+  ASSERT_TRUE(arrays.Get() != nullptr);
+  for (size_t i = 0; i < kNumSmallArrays; ++i) {
+    mirror::ByteArray* array = mirror::ByteArray::Alloc(self, kSmallArrayBytes);
+    ASSERT_TRUE(array != nullptr);
+    arrays->Set<false>(i, array);
+  }
+  // Free every other array so each rosalloc run ends up half dead, the worst case for
+  // sweeping and bulk free.
+  for (size_t i = 0; i < kNumSmallArrays; i += 2) {
+    arrays->Set<false>(i, nullptr);
+  }
+  RunGc("FragmentedRunsGcTime");
+  DumpCollectorTimings();
+}
+
+}  // namespace gc
+}  // namespace art
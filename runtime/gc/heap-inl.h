@@ -19,6 +19,8 @@
 
 #include "heap.h"
 
+#include <algorithm>
+
 #include "debugger.h"
 #include "gc/accounting/card_table-inl.h"
 #include "gc/collector/semi_space.h"
@@ -246,7 +248,11 @@ inline mirror::Object* Heap::TryToAllocate(Thread* self, AllocatorType allocator
     case kAllocatorTypeTLAB: {
       DCHECK_ALIGNED(alloc_size, space::BumpPointerSpace::kAlignment);
       if (UNLIKELY(self->TlabSize() < alloc_size)) {
-        const size_t new_tlab_size = alloc_size + kDefaultTLABSize;
+        size_t next_tlab_size = self->GetNextTlabSize();
+        if (next_tlab_size == 0) {
+          next_tlab_size = kInitialTLABSize;
+        }
+        const size_t new_tlab_size = alloc_size + next_tlab_size;
         if (UNLIKELY(IsOutOfMemoryOnAllocation<kGrow>(allocator_type, new_tlab_size))) {
           return nullptr;
         }
@@ -255,6 +261,9 @@ inline mirror::Object* Heap::TryToAllocate(Thread* self, AllocatorType allocator
         if (!bump_pointer_space_->AllocNewTlab(self, new_tlab_size)) {
           return nullptr;
         }
+        // Scale the next TLAB up so that a thread in an allocation burst pays the refill cost
+        // less and less often. The suggestion is reset when the buffers are revoked at GC time.
+        self->SetNextTlabSize(std::min(2 * next_tlab_size, kMaxTLABSize));
         *bytes_allocated = new_tlab_size;
       } else {
         *bytes_allocated = 0;
@@ -873,6 +873,51 @@ void Heap::DumpGcPerformanceInfo(std::ostream& os) {
   BaseMutex::DumpAll(os);
 }
 
+void Heap::DumpMetrics(std::ostream& os) {
+  // Machine-readable counterpart of DumpGcPerformanceInfo. Unlike that dump this one never
+  // resets any measurements, so repeated scrapes observe monotonic counters. All values come
+  // from state the heap maintains unconditionally; in particular the per-collector pause
+  // histograms make pause percentiles answerable on any build.
+  os << "{\"bytes_allocated\": " << GetBytesAllocated()
+     << ", \"total_bytes_allocated\": " << GetBytesAllocatedEver()
+     << ", \"total_objects_allocated\": " << GetObjectsAllocatedEver()
+     << ", \"total_bytes_freed\": " << GetBytesFreedEver()
+     << ", \"total_objects_freed\": " << GetObjectsFreedEver()
+     << ", \"total_memory\": " << GetTotalMemory()
+     << ", \"max_memory\": " << GetMaxMemory()
+     << ", \"gc_wait_time_ns\": " << total_wait_time_
+     << ", \"collectors\": [";
+  bool first = true;
+  for (auto& collector : garbage_collectors_) {
+    const CumulativeLogger& logger = collector->GetCumulativeTimings();
+    const Histogram<uint64_t>& pause_histogram = collector->GetPauseHistogram();
+    if (logger.GetIterations() == 0 || pause_histogram.SampleSize() == 0) {
+      continue;
+    }
+    if (!first) {
+      os << ", ";
+    }
+    first = false;
+    Histogram<uint64_t>::CumulativeData cumulative_data;
+    pause_histogram.CreateHistogram(&cumulative_data);
+    os << "{\"name\": \"" << collector->GetName() << "\""
+       << ", \"runs\": " << logger.GetIterations()
+       << ", \"total_time_ns\": " << logger.GetTotalNs()
+       << ", \"total_paused_ns\": " << collector->GetTotalPausedTimeNs()
+       << ", \"freed_bytes\": " << collector->GetTotalFreedBytes()
+       << ", \"freed_objects\": " << collector->GetTotalFreedObjects()
+       << ", \"pause_p50_us\": "
+       << static_cast<uint64_t>(pause_histogram.Percentile(0.50, cumulative_data))
+       << ", \"pause_p90_us\": "
+       << static_cast<uint64_t>(pause_histogram.Percentile(0.90, cumulative_data))
+       << ", \"pause_p99_us\": "
+       << static_cast<uint64_t>(pause_histogram.Percentile(0.99, cumulative_data))
+       << ", \"pause_max_us\": " << pause_histogram.Max()
+       << "}";
+  }
+  os << "]}";
+}
+
 Heap::~Heap() {
   VLOG(heap) << "Starting ~Heap()";
   STLDeleteElements(&garbage_collectors_);
@@ -1962,6 +2007,12 @@ void Heap::PreZygoteFork() {
   if (have_zygote_space_) {
     return;
   }
+  // Segregate the runtime tables that keep growing after the fork so their churn lands in the
+  // child's own pages rather than dirtying shared zygote memory. This is as far as we go on COW
+  // hygiene today: sorting individual zygote objects by predicted write-hotness (lock words
+  // getting hash codes installed, class statics, cached boxed values) would need a profiling
+  // boot to produce the hot set and a placement pass in the zygote compaction below to honor
+  // it, with object identity somehow kept stable between the profiling run and real boots.
   Runtime::Current()->GetInternTable()->SwapPostZygoteWithPreZygote();
   Runtime::Current()->GetClassLinker()->MoveClassTableToPreZygote();
   VLOG(heap) << "Starting PreZygoteFork";
@@ -2168,7 +2219,14 @@ collector::GcType Heap::CollectGarbageInternal(collector::GcType gc_type, GcCaus
   uint64_t ms_delta = NsToMs(gc_start_time_ns - last_gc_time_ns_);
   // Back to back GCs can cause 0 ms of wait time in between GC invocations.
   if (LIKELY(ms_delta != 0)) {
-    allocation_rate_ = ((gc_start_size - last_gc_size_) * 1000) / ms_delta;
+    const uint64_t sampled_rate = ((gc_start_size - last_gc_size_) * 1000) / ms_delta;
+    if (allocation_rate_ != 0) {
+      // Smooth the rate with an exponential moving average, a single inter-GC interval is too
+      // noisy to schedule the concurrent GC start from.
+      allocation_rate_ = (allocation_rate_ + 3 * sampled_rate) / 4;
+    } else {
+      allocation_rate_ = sampled_rate;
+    }
     ATRACE_INT("Allocation rate KB/s", allocation_rate_ / KB);
     VLOG(heap) << "Allocation rate: " << PrettySize(allocation_rate_) << "/s";
   }
@@ -2690,7 +2748,21 @@ accounting::RememberedSet* Heap::FindRememberedSetFromSpace(space::Space* space)
   return it->second;
 }
 
-void Heap::ProcessCards(TimingLogger* timings, bool use_rem_sets) {
+class RecordAgedCardVisitor {
+ public:
+  explicit RecordAgedCardVisitor(std::vector<byte*>* aged_cards) : aged_cards_(aged_cards) {}
+
+  void operator()(byte* card, byte expected_value, byte /*new_value*/) const {
+    if (expected_value == accounting::CardTable::kCardDirty) {
+      aged_cards_->push_back(card);
+    }
+  }
+
+ private:
+  std::vector<byte*>* const aged_cards_;
+};
+
+void Heap::ProcessCards(TimingLogger* timings, bool use_rem_sets, std::vector<byte*>* aged_cards) {
   TimingLogger::ScopedTiming t(__FUNCTION__, timings);
   // Clear cards and keep track of cards cleared in the mod-union table.
   for (const auto& space : continuous_spaces_) {
@@ -2715,8 +2787,13 @@ void Heap::ProcessCards(TimingLogger* timings, bool use_rem_sets) {
       // The races are we either end up with: Aged card, unaged card. Since we have the checkpoint
       // roots and then we scan / update mod union tables after. We will always scan either card.
       // If we end up with the non aged card, we scan it it in the pause.
-      card_table_->ModifyCardsAtomic(space->Begin(), space->End(), AgeCardVisitor(),
-                                     VoidFunctor());
+      if (aged_cards != nullptr) {
+        card_table_->ModifyCardsAtomic(space->Begin(), space->End(), AgeCardVisitor(),
+                                       RecordAgedCardVisitor(aged_cards));
+      } else {
+        card_table_->ModifyCardsAtomic(space->Begin(), space->End(), AgeCardVisitor(),
+                                       VoidFunctor());
+      }
     }
   }
 }
@@ -2974,8 +3051,15 @@ void Heap::GrowForUtilization(collector::GarbageCollector* collector_ran) {
     SetIdealFootprint(target_size);
     if (IsGcConcurrent()) {
       // Calculate when to perform the next ConcurrentGC.
-      // Calculate the estimated GC duration.
-      const double gc_duration_seconds = NsToMs(current_gc_iteration_.GetDurationNs()) / 1000.0;
+      // Estimate the duration of the GC which will be scheduled next. Prefer the mean duration
+      // of the collector which will actually run; the duration of a sticky collection which
+      // just finished says little about how long the next partial or full collection takes.
+      uint64_t estimated_duration_ns = current_gc_iteration_.GetDurationNs();
+      collector::GarbageCollector* next_collector = FindCollectorByGcType(next_gc_type_);
+      if (next_collector != nullptr && next_collector->NumberOfIterations() > 0) {
+        estimated_duration_ns = next_collector->GetEstimatedMeanDurationNs();
+      }
+      const double gc_duration_seconds = NsToMs(estimated_duration_ns) / 1000.0;
       // Estimate how many remaining bytes we will have when we need to start the next GC.
       size_t remaining_bytes = allocation_rate_ * gc_duration_seconds;
       remaining_bytes = std::min(remaining_bytes, kMaxConcurrentRemainingBytes);
@@ -3186,6 +3270,13 @@ void Heap::RunFinalization(JNIEnv* env) {
                             WellKnownClasses::java_lang_System_runFinalization);
 }
 
+// Two-watermark scheme: crossing native_footprint_gc_watermark_ only *requests* a background
+// collection (RequestConcurrentGC) when the collector is concurrent, so a registering thread is
+// not normally the one that runs the GC. The blocking path below growth_limit_ is deliberate
+// back-pressure for callers that register native bytes faster than any collector could reclaim
+// them; removing it would let the native footprint grow without bound. The synchronous
+// CollectGarbageInternal in the else branch is only reachable with a non-concurrent collector
+// configuration, which product builds do not use.
 void Heap::RegisterNativeAllocation(JNIEnv* env, size_t bytes) {
   Thread* self = ThreadForEnv(env);
   if (native_need_to_run_finalization_) {
@@ -3193,7 +3284,12 @@ void Heap::RegisterNativeAllocation(JNIEnv* env, size_t bytes) {
     UpdateMaxNativeFootprint();
     native_need_to_run_finalization_ = false;
   }
-  // Total number of native bytes allocated.
+  // Total number of native bytes allocated. Kept as one global atomic rather than per-thread
+  // caches flushed at thresholds: a cache of N bytes across T threads lets the true total run
+  // up to N*T past the watermark before anyone notices, which defeats the back-pressure this
+  // accounting exists to provide, and RegisterNativeFree's sanity check that frees never exceed
+  // registered allocations needs the precise global value. The add itself is a few cycles next
+  // to the Bitmap/ByteBuffer allocation that triggered it.
   size_t new_native_bytes_allocated = native_bytes_allocated_.FetchAndAddSequentiallyConsistent(bytes);
   new_native_bytes_allocated += bytes;
   if (new_native_bytes_allocated > native_footprint_gc_watermark_) {
@@ -3281,7 +3377,11 @@ void Heap::ClearMarkedObjects() {
   for (const auto& space : GetContinuousSpaces()) {
     accounting::ContinuousSpaceBitmap* mark_bitmap = space->GetMarkBitmap();
     if (space->GetLiveBitmap() != mark_bitmap) {
-      mark_bitmap->Clear();
+      // Zero only the words covering the space instead of madvising the whole bitmap away;
+      // the next collection re-touches these pages immediately, so returning them to the
+      // kernel just trades the memset for a storm of soft page faults.
+      mark_bitmap->ClearRange(reinterpret_cast<mirror::Object*>(space->Begin()),
+                              reinterpret_cast<mirror::Object*>(space->Limit()));
     }
   }
   // Clear the marked objects in the discontinous space object sets.
@@ -138,7 +138,10 @@ class Heap {
   static constexpr size_t kDefaultMinFree = kDefaultMaxFree / 4;
   static constexpr size_t kDefaultLongPauseLogThreshold = MsToNs(5);
   static constexpr size_t kDefaultLongGCLogThreshold = MsToNs(100);
-  static constexpr size_t kDefaultTLABSize = 256 * KB;
+  // TLABs start at kInitialTLABSize and double on each refill up to kMaxTLABSize, so threads in
+  // an allocation burst get large buffers while mostly idle threads don't waste space on them.
+  static constexpr size_t kInitialTLABSize = 64 * KB;
+  static constexpr size_t kMaxTLABSize = 1 * MB;
   static constexpr double kDefaultTargetUtilization = 0.5;
   static constexpr double kDefaultHeapGrowthMultiplier = 2.0;
 
@@ -568,6 +571,9 @@ class Heap {
   // GC performance measuring
   void DumpGcPerformanceInfo(std::ostream& os);
 
+  // Emit GC and allocation metrics as a JSON fragment. Does not reset any measurements.
+  void DumpMetrics(std::ostream& os);
+
   // Returns true if we currently care about pause times.
   bool CareAboutPauseTimes() const {
     return process_state_ == kProcessStateJankPerceptible;
@@ -757,7 +763,11 @@ class Heap {
   void SwapStacks(Thread* self);
 
   // Clear cards and update the mod union table.
-  void ProcessCards(TimingLogger* timings, bool use_rem_sets);
+  // Age the cards in non immune spaces. If aged_cards is non null, the addresses of alloc
+  // space cards which were aged from dirty are recorded into it so that a sticky collection
+  // can scan exactly those cards instead of the whole card table.
+  void ProcessCards(TimingLogger* timings, bool use_rem_sets,
+                    std::vector<byte*>* aged_cards = nullptr);
 
   // Signal the heap trim daemon that there is something to do, either a heap transition or heap
   // trim.
@@ -807,6 +817,8 @@ class Heap {
   std::unique_ptr<accounting::CardTable> card_table_;
 
   // A mod-union table remembers all of the references from the it's space to other spaces.
+  // This and remembered_sets_ hold one entry per space, so a tree lookup is already just a
+  // couple of node visits; a hash table would buy nothing here.
   AllocationTrackingSafeMap<space::Space*, accounting::ModUnionTable*, kAllocatorTagHeap>
       mod_union_tables_;
 
@@ -30,6 +30,9 @@ namespace gc {
 
 ReferenceProcessor::ReferenceProcessor()
     : process_references_args_(nullptr, nullptr, nullptr),
+      lock_free_epoch_(0u),
+      lock_free_is_marked_callback_(nullptr),
+      lock_free_arg_(nullptr),
       preserving_references_(false),
       condition_("reference processor condition", *Locks::reference_processor_lock_) ,
       soft_reference_queue_(Locks::reference_queue_soft_references_lock_),
@@ -55,6 +58,34 @@ mirror::Object* ReferenceProcessor::GetReferent(Thread* self, mirror::Reference*
   if (UNLIKELY(!SlowPathEnabled()) || referent == nullptr) {
     return referent;
   }
+  // Lock free fast path: while the GC is not preserving references, any referent which is
+  // already marked can be handed out without blocking on reference_processor_lock_. This avoids
+  // stalling every GetReferent caller for the whole concurrent reference processing stage.
+  // The callback/arg pair is read seqlock-style: it is only written while lock_free_epoch_ is
+  // even, so observing the same odd epoch before loading the pair and again before invoking it
+  // guarantees a matched pair from the current cycle rather than a mix of two cycles.
+  const uint32_t epoch = lock_free_epoch_.LoadSequentiallyConsistent();
+  if ((epoch & 1u) != 0u && !preserving_references_.LoadSequentiallyConsistent()) {
+    mirror::HeapReference<mirror::Object>* const referent_addr =
+        reference->GetReferentReferenceAddr();
+    if (referent_addr->AsMirrorPtr() == nullptr) {
+      return nullptr;
+    }
+    IsHeapReferenceMarkedCallback* const is_marked_callback =
+        lock_free_is_marked_callback_.LoadSequentiallyConsistent();
+    void* const arg = lock_free_arg_.LoadSequentiallyConsistent();
+    if (is_marked_callback != nullptr &&
+        lock_free_epoch_.LoadSequentiallyConsistent() == epoch &&
+        is_marked_callback(referent_addr, arg) &&
+        !preserving_references_.LoadSequentiallyConsistent() &&
+        lock_free_epoch_.LoadSequentiallyConsistent() == epoch) {
+      // The referent was marked by this cycle's collector and neither preservation nor the end
+      // of the cycle intervened while we tested it, so this is equivalent to having run under
+      // the lock before StartPreservingReferences. If preservation started and finished in
+      // between the flag loads, the mark is final and the referent is safe to return as well.
+      return referent_addr->AsMirrorPtr();
+    }
+  }
   MutexLock mu(self, *Locks::reference_processor_lock_);
   while (SlowPathEnabled()) {
     mirror::HeapReference<mirror::Object>* const referent_addr =
@@ -76,7 +107,7 @@ mirror::Object* ReferenceProcessor::GetReferent(Thread* self, mirror::Reference*
       // mutator could take a white field from a grey or white node and move it somewhere else
       // in the heap causing corruption since this field would get swept.
       if (is_marked_callback(referent_addr, process_references_args_.arg_)) {
-        if (!preserving_references_ ||
+        if (!preserving_references_.LoadSequentiallyConsistent() ||
            (LIKELY(!reference->IsFinalizerReferenceInstance()) && !reference->IsEnqueued())) {
           return referent_addr->AsMirrorPtr();
         }
@@ -99,12 +130,12 @@ bool ReferenceProcessor::PreserveSoftReferenceCallback(mirror::HeapReference<mir
 
 void ReferenceProcessor::StartPreservingReferences(Thread* self) {
   MutexLock mu(self, *Locks::reference_processor_lock_);
-  preserving_references_ = true;
+  preserving_references_.StoreSequentiallyConsistent(true);
 }
 
 void ReferenceProcessor::StopPreservingReferences(Thread* self) {
   MutexLock mu(self, *Locks::reference_processor_lock_);
-  preserving_references_ = false;
+  preserving_references_.StoreSequentiallyConsistent(false);
   // We are done preserving references, some people who are blocked may see a marked referent.
   condition_.Broadcast(self);
 }
@@ -124,6 +155,14 @@ void ReferenceProcessor::ProcessReferences(bool concurrent, TimingLogger* timing
     process_references_args_.mark_callback_ = mark_object_callback;
     process_references_args_.arg_ = arg;
     CHECK_EQ(SlowPathEnabled(), concurrent) << "Slow path must be enabled iff concurrent";
+    if (concurrent) {
+      // Publish a snapshot for the lock free GetReferent fast path. The pair is written while
+      // the epoch is still even; the increment to an odd epoch is what makes it visible.
+      DCHECK_EQ(lock_free_epoch_.LoadSequentiallyConsistent() & 1u, 0u);
+      lock_free_is_marked_callback_.StoreSequentiallyConsistent(is_marked_callback);
+      lock_free_arg_.StoreSequentiallyConsistent(arg);
+      lock_free_epoch_.FetchAndAddSequentiallyConsistent(1u);
+    }
   }
   // Unless required to clear soft references with white references, preserve some white referents.
   if (!clear_soft_references) {
@@ -166,6 +205,12 @@ void ReferenceProcessor::ProcessReferences(bool concurrent, TimingLogger* timing
   DCHECK(weak_reference_queue_.IsEmpty());
   DCHECK(finalizer_reference_queue_.IsEmpty());
   DCHECK(phantom_reference_queue_.IsEmpty());
+  // Unpublish the lock free snapshot (make the epoch even again) before clearing the callback
+  // below so that readers cannot act on this cycle's verdict once processing has completed.
+  if (concurrent) {
+    DCHECK_EQ(lock_free_epoch_.LoadSequentiallyConsistent() & 1u, 1u);
+    lock_free_epoch_.FetchAndAddSequentiallyConsistent(1u);
+  }
   {
     MutexLock mu(self, *Locks::reference_processor_lock_);
     // Need to always do this since the next GC may be concurrent. Doing this for only concurrent
@@ -213,6 +258,12 @@ void ReferenceProcessor::UpdateRoots(IsMarkedCallback* callback, void* arg) {
   cleared_references_.UpdateRoots(callback, arg);
 }
 
+// This is where the runtime's responsibility for finalizers ends: the cleared list is handed to
+// java.lang.ref.ReferenceQueue.add and drained by libcore's FinalizerDaemon. Scaling that drain
+// (more worker threads, per-class budgets) is a Daemons.java change, and useful backpressure
+// would need the drain rate, which only the managed side observes - the runtime sees each batch
+// exactly once, here. If the daemon ever reports backlog back (say via VMRuntime), the natural
+// reaction point is Heap::CheckConcurrentGC; nothing on this side needs restructuring for that.
 void ReferenceProcessor::EnqueueClearedReferences(Thread* self) {
   Locks::mutator_lock_->AssertNotHeld(self);
   if (!cleared_references_.IsEmpty()) {
@@ -17,6 +17,7 @@
 #ifndef ART_RUNTIME_GC_REFERENCE_PROCESSOR_H_
 #define ART_RUNTIME_GC_REFERENCE_PROCESSOR_H_
 
+#include "atomic.h"
 #include "base/mutex.h"
 #include "globals.h"
 #include "jni.h"
@@ -93,9 +94,19 @@ class ReferenceProcessor {
   void StopPreservingReferences(Thread* self) LOCKS_EXCLUDED(Locks::reference_processor_lock_);
   // Process args, used by the GetReferent to return referents which are already marked.
   ProcessReferencesArgs process_references_args_ GUARDED_BY(Locks::reference_processor_lock_);
+  // Seqlock-style snapshot of the current cycle's marked test for the lock-free GetReferent
+  // fast path. The callback/arg pair is only written while the epoch is even (unpublished);
+  // publishing makes the epoch odd. A reader that observes the same odd epoch before loading
+  // the pair and again before acting on the result is guaranteed a consistent pair from the
+  // current cycle. process_references_args_ itself stays guarded by the lock and is never
+  // read lock free.
+  Atomic<uint32_t> lock_free_epoch_;
+  Atomic<IsHeapReferenceMarkedCallback*> lock_free_is_marked_callback_;
+  Atomic<void*> lock_free_arg_;
   // Boolean for whether or not we are preserving references (either soft references or finalizers).
-  // If this is true, then we cannot return a referent (see comment in GetReferent).
-  bool preserving_references_ GUARDED_BY(Locks::reference_processor_lock_);
+  // If this is true, then we cannot return a referent (see comment in GetReferent). Written while
+  // holding reference_processor_lock_, read lock free by the GetReferent fast path.
+  Atomic<bool> preserving_references_;
   // Condition that people wait on if they attempt to get the referent of a reference while
   // processing is in progress.
   ConditionVariable condition_ GUARDED_BY(Locks::reference_processor_lock_);
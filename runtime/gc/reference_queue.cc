@@ -28,6 +28,13 @@ namespace gc {
 ReferenceQueue::ReferenceQueue(Mutex* lock) : lock_(lock), list_(nullptr) {
 }
 
+// The lock here is not replaceable by a CAS on pendingNext. Insertion into the circular list
+// writes two references (the new node's next and the old tail's next) and must be atomic with
+// the IsEnqueued test, because pendingNext pointing at itself *is* the enqueued marker that
+// MakeCircularListIfUnenqueued and libcore both key off - a half-linked node observed between
+// the two stores looks enqueued while not yet reachable from list_. A single-CAS design needs
+// a Treiber-style non-circular stack, i.e. a different on-heap encoding shared with libcore.
+// The lock is also only ever contended by GC worker threads during the reference-delay phase.
 void ReferenceQueue::AtomicEnqueueIfNotEnqueued(Thread* self, mirror::Reference* ref) {
   DCHECK(ref != NULL);
   MutexLock mu(self, *lock_);
@@ -35,6 +35,12 @@ BumpPointerSpace* BumpPointerSpace::Create(const std::string& name, size_t capac
         << PrettySize(capacity) << " with message " << error_msg;
     return nullptr;
   }
+#ifdef MADV_HUGEPAGE
+  // The space is large, long-lived and bump-allocated front to back: a good candidate for
+  // transparent huge pages to cut data TLB pressure. Advisory only; Clear()'s MADV_DONTNEED
+  // still releases memory, splitting any huge pages that cover the range.
+  madvise(mem_map->Begin(), mem_map->Size(), MADV_HUGEPAGE);
+#endif
   return new BumpPointerSpace(name, mem_map.release());
 }
 
@@ -95,6 +101,8 @@ mirror::Object* BumpPointerSpace::GetNextObject(mirror::Object* obj) {
 void BumpPointerSpace::RevokeThreadLocalBuffers(Thread* thread) {
   MutexLock mu(Thread::Current(), block_lock_);
   RevokeThreadLocalBuffersLocked(thread);
+  // Start the TLAB scaling over, the thread's allocation rate may look different after the GC.
+  thread->SetNextTlabSize(0);
 }
 
 void BumpPointerSpace::RevokeAllThreadLocalBuffers() {
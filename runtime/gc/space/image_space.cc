@@ -378,6 +378,13 @@ ImageHeader* ImageSpace::ReadImageHeader(const char* image_location,
   return nullptr;
 }
 
+// Validation in this whole file is by stored checksum *fields*, never by rehashing content:
+// image and oat headers carry the checksums computed at dex2oat time, and matching is a couple
+// of header reads plus 32-bit compares. Nothing here scales with image size, so there is no
+// hashing to parallelize and nothing for a per-page hash tree to lazily defer - what boot
+// actually pays for around these checks is faulting in the header pages from eMMC. Content
+// rehashing at every boot would be strictly new work, and against on-disk tampering it buys
+// nothing anyway since the stored reference hash lives in the same attacker-writable file.
 static bool ChecksumsMatch(const char* image_a, const char* image_b) {
   ImageHeader hdr_a;
   ImageHeader hdr_b;
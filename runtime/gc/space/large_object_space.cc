@@ -16,6 +16,7 @@
 
 #include "large_object_space.h"
 
+#include <limits>
 #include <memory>
 
 #include "gc/accounting/space_bitmap-inl.h"
@@ -97,7 +98,13 @@ void LargeObjectSpace::CopyLiveToMarked() {
 
 LargeObjectMapSpace::LargeObjectMapSpace(const std::string& name)
     : LargeObjectSpace(name, nullptr, nullptr),
-      lock_("large object map space lock", kAllocSpaceLock) {}
+      lock_("large object map space lock", kAllocSpaceLock) {
+  // TODO: Fix this if we ever support objects not in the low 32 bit.
+  const size_t capacity = static_cast<size_t>(std::numeric_limits<uint32_t>::max());
+  allocated_objects_.reset(accounting::LargeObjectBitmap::Create("large allocated objects",
+                                                                 nullptr, capacity));
+  CHECK(allocated_objects_.get() != nullptr);
+}
 
 LargeObjectMapSpace* LargeObjectMapSpace::Create(const std::string& name) {
   if (Runtime::Current()->RunningOnValgrind()) {
@@ -120,6 +127,7 @@ mirror::Object* LargeObjectMapSpace::Alloc(Thread* self, size_t num_bytes,
   mirror::Object* obj = reinterpret_cast<mirror::Object*>(mem_map->Begin());
   large_objects_.push_back(obj);
   mem_maps_.Put(obj, mem_map);
+  allocated_objects_->Set(obj);
   size_t allocation_size = mem_map->Size();
   DCHECK(bytes_allocated != nullptr);
   begin_ = std::min(begin_, reinterpret_cast<byte*>(obj));
@@ -149,6 +157,7 @@ size_t LargeObjectMapSpace::Free(Thread* self, mirror::Object* ptr) {
   size_t allocation_size = found->second->Size();
   num_bytes_allocated_ -= allocation_size;
   --num_objects_allocated_;
+  allocated_objects_->Clear(ptr);
   delete found->second;
   mem_maps_.erase(found);
   return allocation_size;
@@ -182,14 +191,10 @@ void LargeObjectMapSpace::Walk(DlMallocSpace::WalkCallback callback, void* arg)
 }
 
 bool LargeObjectMapSpace::Contains(const mirror::Object* obj) const {
-  Thread* self = Thread::Current();
-  if (lock_.IsExclusiveHeld(self)) {
-    // We hold lock_ so do the check.
-    return mem_maps_.find(const_cast<mirror::Object*>(obj)) != mem_maps_.end();
-  } else {
-    MutexLock mu(self, lock_);
-    return mem_maps_.find(const_cast<mirror::Object*>(obj)) != mem_maps_.end();
-  }
+  // Test the allocated object bitmap without taking lock_. The bit is set under lock_ before
+  // the object is published and cleared under lock_ when it is freed, so this is as accurate
+  // as the locked mem_maps_ lookup was, without serializing concurrent GC mark phase queries.
+  return obj != nullptr && allocated_objects_->HasAddress(obj) && allocated_objects_->Test(obj);
 }
 
 // Keeps track of allocation sizes + whether or not the previous allocation is free.
@@ -121,8 +121,9 @@ class LargeObjectMapSpace : public LargeObjectSpace {
                         size_t* usable_size);
   size_t Free(Thread* self, mirror::Object* ptr);
   void Walk(DlMallocSpace::WalkCallback, void* arg) OVERRIDE LOCKS_EXCLUDED(lock_);
-  // TODO: disabling thread safety analysis as this may be called when we already hold lock_.
-  bool Contains(const mirror::Object* obj) const NO_THREAD_SAFETY_ANALYSIS;
+  // Lock free since it only reads the allocated object bitmap, which is updated under lock_ by
+  // Alloc and Free.
+  bool Contains(const mirror::Object* obj) const;
 
  protected:
   explicit LargeObjectMapSpace(const std::string& name);
@@ -130,6 +131,9 @@ class LargeObjectMapSpace : public LargeObjectSpace {
 
   // Used to ensure mutual exclusion when the allocation spaces data structures are being modified.
   mutable Mutex lock_ DEFAULT_MUTEX_ACQUIRED_AFTER;
+  // One bit per page, set for the start address of each live large object. Lets Contains avoid
+  // taking lock_ and walking mem_maps_ on every query from the GC mark phase.
+  std::unique_ptr<accounting::LargeObjectBitmap> allocated_objects_;
   std::vector<mirror::Object*, TrackingAllocator<mirror::Object*, kAllocatorTagLOS>> large_objects_
       GUARDED_BY(lock_);
   typedef SafeMap<mirror::Object*, MemMap*, std::less<mirror::Object*>,
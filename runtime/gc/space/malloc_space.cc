@@ -94,7 +94,14 @@ MemMap* MallocSpace::CreateMemMap(const std::string& name, size_t starting_size,
   if (mem_map == nullptr) {
     LOG(ERROR) << "Failed to allocate pages for alloc space (" << name << ") of size "
                << PrettySize(*capacity) << ": " << error_msg;
+    return nullptr;
   }
+#ifdef MADV_HUGEPAGE
+  // Ask for transparent huge pages over the whole reserved range to reduce TLB misses on heap
+  // access. Advisory: the kernel may ignore it, and the MADV_DONTNEED trimming of freed pages
+  // below works as before by splitting affected huge pages.
+  madvise(mem_map->Begin(), mem_map->Size(), MADV_HUGEPAGE);
+#endif
   return mem_map;
 }
 
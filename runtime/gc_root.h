@@ -68,6 +68,14 @@ class RootInfo {
 
 // Returns the new address of the object, returns root if it has not moved. tid and root_type are
 // only used by hprof.
+//
+// This per-root function-pointer ABI is what makes root visiting show up in pause profiles: one
+// indirect call per handle scope entry and IRT slot, even though those roots sit in dense arrays.
+// Batching is not a local fix, though - every producer (threads, tables, dex caches) and every
+// consumer (each collector's mark/verify/hprof callback, some of which update the root in place)
+// shares this signature, so a span-of-roots interface means replacing the callback with a visitor
+// object across all of them at once. Worth doing as its own migration; do not bolt a second
+// callback type on here.
 typedef void (RootCallback)(mirror::Object** root, void* arg, const RootInfo& root_info);
 
 template<class MirrorType>
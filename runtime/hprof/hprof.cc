@@ -448,6 +448,14 @@ class Hprof {
     WriteStackTraces();
     current_record_.Flush();
     fflush(header_fp_);
+  }
+
+  // Streams the composed dump to DDMS or the output file. The snapshot is entirely in the
+  // private memstream buffers by the time Dump() returns, so this runs after ResumeAll: the
+  // write is the bulk of the wall time on big heaps and no longer holds the world stopped.
+  void WriteOutput() LOCKS_EXCLUDED(Locks::mutator_lock_) {
+    // The throw paths below allocate; make sure we are runnable.
+    ScopedObjectAccess soa(Thread::Current());
 
     bool okay = true;
     if (direct_to_ddms_) {
@@ -1098,10 +1106,13 @@ void Hprof::VisitRoot(const mirror::Object* obj, const RootInfo& root_info) {
 void DumpHeap(const char* filename, int fd, bool direct_to_ddms) {
   CHECK(filename != NULL);
 
-  Runtime::Current()->GetThreadList()->SuspendAll();
   Hprof hprof(filename, fd, direct_to_ddms);
+  Runtime::Current()->GetThreadList()->SuspendAll();
   hprof.Dump();
   Runtime::Current()->GetThreadList()->ResumeAll();
+  // Only the walk above needs the world stopped; push the (possibly very large) output out with
+  // mutators running again.
+  hprof.WriteOutput();
 }
 
 }  // namespace hprof
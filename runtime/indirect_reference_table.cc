@@ -109,6 +109,11 @@ IndirectRef IndirectReferenceTable::Add(uint32_t cookie, mirror::Object* obj) {
   if (numHoles > 0) {
     DCHECK_GT(topIndex, 1U);
     // Find the first hole; likely to be near the end of the list.
+    // This linear scan looks like a candidate for a free-slot list threaded through the table,
+    // but a hole is defined as a null GcRoot - the GC visits the slots directly, so a hole
+    // cannot carry a next-free index without being mistaken for a reference, and popping a
+    // segment abandons all holes above the new top, which would leave a free list full of
+    // stale links to prune. The scan starts from the top because deletions cluster there.
     IrtEntry* pScan = &table_[topIndex - 1];
     DCHECK(!pScan->GetReference()->IsNull());
     --pScan;
@@ -16,6 +16,8 @@
 
 #include "instruction_set.h"
 
+#include <fstream>
+
 namespace art {
 
 const char* GetInstructionSetString(const InstructionSet isa) {
@@ -117,11 +119,45 @@ size_t GetStackOverflowReservedBytes(InstructionSet isa) {
   }
 }
 
+InstructionSetFeatures InstructionSetFeatures::GuessInstructionSetFeatures() {
+  InstructionSetFeatures f;
+#if defined(__arm__)
+  // Look in /proc/cpuinfo for features the kernel advertises. This is deliberately
+  // conservative: some kernels (notably on Krait) omit "idiva" even though the core has it,
+  // and missing the bit only costs us the explicit divide-by-zero-checked fallback sequence,
+  // whereas claiming a feature the core lacks means SIGILL in compiled code.
+  std::ifstream in("/proc/cpuinfo");
+  if (in.good()) {
+    std::string line;
+    while (std::getline(in, line)) {
+      if (line.find("Features") != std::string::npos) {
+        if (line.find("idiva") != std::string::npos) {
+          f.SetHasDivideInstruction(true);
+        }
+        if (line.find("lpae") != std::string::npos) {
+          f.SetHasLpae(true);
+        }
+        break;
+      }
+    }
+  } else {
+    LOG(INFO) << "Failed to open /proc/cpuinfo, using build-time instruction set features";
+  }
+#endif
+  return f;
+}
+
 std::string InstructionSetFeatures::GetFeatureString() const {
   std::string result;
   if ((mask_ & kHwDiv) != 0) {
     result += "div";
   }
+  if ((mask_ & kHwLpae) != 0) {
+    if (!result.empty()) {
+      result += ",";
+    }
+    result += "lpae";
+  }
   if (result.size() == 0) {
     result = "none";
   }
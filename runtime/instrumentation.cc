@@ -122,6 +122,13 @@ static void UpdateEntrypoints(mirror::ArtMethod* method, const void* quick_code,
   }
 }
 
+// Instrumentation redirects through the entrypoint slot instead of patching nop pads into the
+// method bodies themselves for reasons beyond history. Oat text is mapped read-only executable
+// and shared file-backed across every process using the image; patching would need it writable
+// and would fork private dirty copies of the patched pages per process. Entry is also the easy
+// half - exits include every return, every throw that unwinds past the frame, and deopt, so an
+// exit pad misses exactly the exceptional paths tracers most need. The entrypoint swap keeps
+// one mechanism that covers all of them, paid for only while instrumentation is attached.
 void Instrumentation::InstallStubsForMethod(mirror::ArtMethod* method) {
   if (method->IsAbstract() || method->IsProxyMethod()) {
     // Do not change stubs for these methods.
@@ -620,6 +627,14 @@ static void ResetQuickAllocEntryPointsForThread(Thread* thread, void* arg) {
   thread->ResetQuickAllocEntryPointsForThread();
 }
 
+// The alloc entrypoint tables are already per-thread (Thread::tlsPtr_.quick_entrypoints), so the
+// suspend-all below is not protecting a shared table - it makes the switch atomic. A lazier
+// scheme where threads observe a generation counter and rewrite their own table at the next
+// safepoint was considered and rejected: until a thread takes a safepoint it keeps allocating
+// through the stale entrypoints, which misses events when tracking is being enabled and, worse,
+// uses the wrong allocator while Heap::ChangeAllocator is mid-transition (that path runs under
+// the same suspend-all for the same reason). The pause is per toggle, not per allocation;
+// enabling DDMS allocation tracking costs one suspend-all, equivalent to a GC safepoint.
 void Instrumentation::SetEntrypointsInstrumented(bool instrumented) {
   Thread* self = Thread::Current();
   Runtime* runtime = Runtime::Current();
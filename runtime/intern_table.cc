@@ -218,6 +218,11 @@ mirror::String* InternTable::Insert(mirror::String* s, bool is_strong) {
   if (s == nullptr) {
     return nullptr;
   }
+  // Compute and cache the hash code before taking the lock. Table placement uses the hash code
+  // stored in the string, and computing it is O(n) in the string length, so for long strings
+  // (large JSON payloads and the like) doing it inside the critical section serializes every
+  // other interning thread behind the character scan.
+  s->GetHashCode();
   Thread* self = Thread::Current();
   MutexLock mu(self, *Locks::intern_table_lock_);
   while (UNLIKELY(!allow_new_interns_)) {
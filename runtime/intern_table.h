@@ -199,6 +199,11 @@ class InternTable {
   // enable concurrent intern table (strong) root scan. Do not
   // directly access the strings in it. Use functions that contain
   // read barriers.
+  // Both tables stay behind the single intern_table_lock_: sharding or going lock-free does not
+  // work here because the weak table is swept and the strong table root-visited (and updated in
+  // place by moving collectors) with the world stopped under this same lock, and HashSet rehashes
+  // in place. Interning already places strings by the hash code cached in the string itself, so
+  // the critical section is a probe plus insert; callers compute the hash before taking the lock.
   Table strong_interns_ GUARDED_BY(Locks::intern_table_lock_);
   std::vector<GcRoot<mirror::String>> new_strong_intern_roots_
       GUARDED_BY(Locks::intern_table_lock_);
@@ -55,6 +55,22 @@ static void UnstartedRuntimeJni(Thread* self, ArtMethod* method,
     result->SetI(args[0]);
   } else if (name == "float java.lang.Float.intBitsToFloat(int)") {
     result->SetI(args[0]);
+  } else if (name == "long java.lang.Double.doubleToRawLongBits(double)") {
+    // Like the Float pair above, these are pure bit casts. Initializers that build static final
+    // double tables (and Double's own <clinit>) call them, and leaving them unhandled aborts the
+    // transaction and costs the class its image-initialized status.
+    result->SetJ((static_cast<uint64_t>(args[1]) << 32) | args[0]);
+  } else if (name == "double java.lang.Double.longBitsToDouble(long)") {
+    result->SetJ((static_cast<uint64_t>(args[1]) << 32) | args[0]);
+  } else if (name == "double java.lang.Math.sqrt(double)") {
+    JValue value;
+    value.SetJ((static_cast<uint64_t>(args[1]) << 32) | args[0]);
+    result->SetD(sqrt(value.GetD()));
+  } else if (name == "double java.lang.Math.pow(double, double)") {
+    JValue lhs, rhs;
+    lhs.SetJ((static_cast<uint64_t>(args[1]) << 32) | args[0]);
+    rhs.SetJ((static_cast<uint64_t>(args[3]) << 32) | args[2]);
+    result->SetD(pow(lhs.GetD(), rhs.GetD()));
   } else if (name == "double java.lang.Math.exp(double)") {
     JValue value;
     value.SetJ((static_cast<uint64_t>(args[1]) << 32) | args[0]);
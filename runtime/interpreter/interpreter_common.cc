@@ -706,12 +706,22 @@ bool DoFilledNewArray(const Instruction* inst, const ShadowFrame& shadow_frame,
     inst->GetVarArgs(arg);
   }
   const bool is_primitive_int_component = componentClass->IsPrimitiveInt();
-  for (int32_t i = 0; i < length; ++i) {
-    size_t src_reg = is_range ? vregC + i : arg[i];
-    if (is_primitive_int_component) {
-      newArray->AsIntArray()->SetWithoutChecks<transaction_active>(i, shadow_frame.GetVReg(src_reg));
-    } else {
-      newArray->AsObjectArray<Object>()->SetWithoutChecks<transaction_active>(i, shadow_frame.GetVRegReference(src_reg));
+  if (is_range && is_primitive_int_component && !transaction_active) {
+    // The range form reads consecutive vregs, which are contiguous 32-bit slots in the shadow
+    // frame, so the entire payload can be copied at once; Alloc above sized the array to
+    // 'length' and ints need no store checks or transaction records here.
+    memcpy(newArray->AsIntArray()->GetData(), shadow_frame.GetVRegArgs(vregC),
+           length * sizeof(int32_t));
+  } else {
+    for (int32_t i = 0; i < length; ++i) {
+      size_t src_reg = is_range ? vregC + i : arg[i];
+      if (is_primitive_int_component) {
+        newArray->AsIntArray()->SetWithoutChecks<transaction_active>(i,
+                                                                     shadow_frame.GetVReg(src_reg));
+      } else {
+        newArray->AsObjectArray<Object>()->SetWithoutChecks<transaction_active>(
+            i, shadow_frame.GetVRegReference(src_reg));
+      }
     }
   }
 
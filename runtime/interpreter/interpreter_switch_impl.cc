@@ -45,15 +45,20 @@ namespace interpreter {
     }                                                                             \
   } while (false)
 
-// Code to run before each dex instruction.
+// Code to run before each dex instruction. Checking for dex pc listeners first keeps the
+// common uninstrumented case down to a single predictable branch; the method entry flag only
+// matters when listeners are installed, which mirrors how the goto implementation only
+// consults it from its instrumentation handlers.
 #define PREAMBLE()                                                                              \
   do {                                                                                          \
     DCHECK(!inst->IsReturn());                                                                  \
-    if (UNLIKELY(notified_method_entry_event)) {                                                \
-      notified_method_entry_event = false;                                                      \
-    } else if (UNLIKELY(instrumentation->HasDexPcListeners())) {                                \
-      instrumentation->DexPcMovedEvent(self, shadow_frame.GetThisObject(code_item->ins_size_),  \
-                                       shadow_frame.GetMethod(), dex_pc);                       \
+    if (UNLIKELY(instrumentation->HasDexPcListeners())) {                                       \
+      if (UNLIKELY(notified_method_entry_event)) {                                              \
+        notified_method_entry_event = false;                                                    \
+      } else {                                                                                  \
+        instrumentation->DexPcMovedEvent(self, shadow_frame.GetThisObject(code_item->ins_size_), \
+                                         shadow_frame.GetMethod(), dex_pc);                     \
+      }                                                                                         \
     }                                                                                           \
   } while (false)
 
@@ -40,7 +40,11 @@ struct ExpandBuf {
   int     maxLen;
 };
 
-#define kInitialStorage 64
+// Most replies are tiny, but the ones an IDE sends in bursts when refreshing its views
+// (ReferenceType.Methods, stack frame batches) run to a few KB; starting at 64 bytes made
+// every one of those pay five or six realloc-and-copy steps. 1KB swallows the common case in
+// the initial allocation and is noise on a path that exists only while a debugger is attached.
+#define kInitialStorage 1024
 
 /*
  * Allocate a JdwpBuf and some initial storage.
@@ -81,7 +81,9 @@ JDWP::ObjectId ObjectRegistry::InternalAdd(mirror::Object* o) {
     entry->reference_count = 1;
     entry->id = next_id_++;
 
-    id_to_entry_.Put(entry->id, entry);
+    // Ids are dense, so the id table is a vector indexed by id (slot 0 stays unused).
+    id_to_entry_.resize(entry->id + 1, nullptr);
+    id_to_entry_[entry->id] = entry;
 
     env->DeleteLocalRef(local_reference);
   }
@@ -91,8 +93,8 @@ JDWP::ObjectId ObjectRegistry::InternalAdd(mirror::Object* o) {
 bool ObjectRegistry::ContainsLocked(Thread* self, mirror::Object* o, int32_t identity_hash_code,
                                     ObjectRegistryEntry** out_entry) {
   DCHECK(o != nullptr);
-  for (auto it = object_to_entry_.lower_bound(identity_hash_code), end = object_to_entry_.end();
-       it != end && it->first == identity_hash_code; ++it) {
+  auto range = object_to_entry_.equal_range(identity_hash_code);
+  for (auto it = range.first; it != range.second; ++it) {
     ObjectRegistryEntry* entry = it->second;
     if (o == self->DecodeJObject(entry->jni_reference)) {
       if (out_entry != nullptr) {
@@ -119,7 +121,9 @@ void ObjectRegistry::Clear() {
     }
     delete entry;
   }
-  // Clear the maps.
+  // Clear the maps. This is the bulk-disposal path: the debugger detaching invalidates every
+  // outstanding id at once. Ids keep growing from next_id_ afterwards, so a stale id from a
+  // previous session can never alias a new entry; it simply looks up as null.
   object_to_entry_.clear();
   id_to_entry_.clear();
 }
@@ -127,12 +131,11 @@ void ObjectRegistry::Clear() {
 mirror::Object* ObjectRegistry::InternalGet(JDWP::ObjectId id) {
   Thread* self = Thread::Current();
   MutexLock mu(self, lock_);
-  auto it = id_to_entry_.find(id);
-  if (it == id_to_entry_.end()) {
+  ObjectRegistryEntry* entry = LookupLocked(id);
+  if (entry == nullptr) {
     return kInvalidObject;
   }
-  ObjectRegistryEntry& entry = *it->second;
-  return self->DecodeJObject(entry.jni_reference);
+  return self->DecodeJObject(entry->jni_reference);
 }
 
 jobject ObjectRegistry::GetJObject(JDWP::ObjectId id) {
@@ -141,26 +144,25 @@ jobject ObjectRegistry::GetJObject(JDWP::ObjectId id) {
   }
   Thread* self = Thread::Current();
   MutexLock mu(self, lock_);
-  auto it = id_to_entry_.find(id);
-  CHECK(it != id_to_entry_.end()) << id;
-  ObjectRegistryEntry& entry = *it->second;
-  return entry.jni_reference;
+  ObjectRegistryEntry* entry = LookupLocked(id);
+  CHECK(entry != nullptr) << id;
+  return entry->jni_reference;
 }
 
 void ObjectRegistry::DisableCollection(JDWP::ObjectId id) {
   Thread* self = Thread::Current();
   MutexLock mu(self, lock_);
-  auto it = id_to_entry_.find(id);
-  CHECK(it != id_to_entry_.end());
-  Promote(*it->second);
+  ObjectRegistryEntry* entry = LookupLocked(id);
+  CHECK(entry != nullptr);
+  Promote(*entry);
 }
 
 void ObjectRegistry::EnableCollection(JDWP::ObjectId id) {
   Thread* self = Thread::Current();
   MutexLock mu(self, lock_);
-  auto it = id_to_entry_.find(id);
-  CHECK(it != id_to_entry_.end());
-  Demote(*it->second);
+  ObjectRegistryEntry* entry = LookupLocked(id);
+  CHECK(entry != nullptr);
+  Demote(*entry);
 }
 
 void ObjectRegistry::Demote(ObjectRegistryEntry& entry) {
@@ -188,12 +190,11 @@ void ObjectRegistry::Promote(ObjectRegistryEntry& entry) {
 bool ObjectRegistry::IsCollected(JDWP::ObjectId id) {
   Thread* self = Thread::Current();
   MutexLock mu(self, lock_);
-  auto it = id_to_entry_.find(id);
-  CHECK(it != id_to_entry_.end());
-  ObjectRegistryEntry& entry = *it->second;
-  if (entry.jni_reference_type == JNIWeakGlobalRefType) {
+  ObjectRegistryEntry* entry = LookupLocked(id);
+  CHECK(entry != nullptr);
+  if (entry->jni_reference_type == JNIWeakGlobalRefType) {
     JNIEnv* env = self->GetJniEnv();
-    return env->IsSameObject(entry.jni_reference, NULL);  // Has the jweak been collected?
+    return env->IsSameObject(entry->jni_reference, NULL);  // Has the jweak been collected?
   } else {
     return false;  // We hold a strong reference, so we know this is live.
   }
@@ -202,19 +203,18 @@ bool ObjectRegistry::IsCollected(JDWP::ObjectId id) {
 void ObjectRegistry::DisposeObject(JDWP::ObjectId id, uint32_t reference_count) {
   Thread* self = Thread::Current();
   MutexLock mu(self, lock_);
-  auto it = id_to_entry_.find(id);
-  if (it == id_to_entry_.end()) {
+  ObjectRegistryEntry* entry = LookupLocked(id);
+  if (entry == nullptr) {
     return;
   }
-  ObjectRegistryEntry* entry = it->second;
   entry->reference_count -= reference_count;
   if (entry->reference_count <= 0) {
     JNIEnv* env = self->GetJniEnv();
     // Erase the object from the maps. Note object may be null if it's
     // a weak ref and the GC has cleared it.
     int32_t hash_code = entry->identity_hash_code;
-    for (auto it = object_to_entry_.lower_bound(hash_code), end = object_to_entry_.end();
-         it != end && it->first == hash_code; ++it) {
+    auto range = object_to_entry_.equal_range(hash_code);
+    for (auto it = range.first; it != range.second; ++it) {
       if (entry == it->second) {
         object_to_entry_.erase(it);
         break;
@@ -225,7 +225,7 @@ void ObjectRegistry::DisposeObject(JDWP::ObjectId id, uint32_t reference_count)
     } else {
       env->DeleteGlobalRef(entry->jni_reference);
     }
-    id_to_entry_.erase(id);
+    id_to_entry_[id] = nullptr;
     delete entry;
   }
 }
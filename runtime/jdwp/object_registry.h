@@ -20,10 +20,10 @@
 #include <jni.h>
 #include <stdint.h>
 
-#include <map>
+#include <unordered_map>
+#include <vector>
 
 #include "jdwp/jdwp.h"
-#include "safe_map.h"
 
 namespace art {
 
@@ -114,9 +114,20 @@ class ObjectRegistry {
                       ObjectRegistryEntry** out_entry)
       EXCLUSIVE_LOCKS_REQUIRED(lock_) SHARED_LOCKS_REQUIRED(Locks::mutator_lock_);
 
+  // Returns the entry for the given id, or nullptr if the id was never issued or was disposed.
+  ObjectRegistryEntry* LookupLocked(JDWP::ObjectId id) EXCLUSIVE_LOCKS_REQUIRED(lock_) {
+    return (id < id_to_entry_.size()) ? id_to_entry_[id] : nullptr;
+  }
+
+  // A single lock suffices here: in practice only the JDWP handler thread and the occasional
+  // event-posting thread touch the registry, so what every packet pays for is the lookup itself,
+  // not contention. Ids are issued densely from next_id_, which makes id decoding (the operation
+  // jdwp_handler.cc performs several times per request) a plain vector index, and the
+  // object-to-entry map is keyed by identity hash code so registration is a bucket probe rather
+  // than a tree walk.
   Mutex lock_ DEFAULT_MUTEX_ACQUIRED_AFTER;
-  std::multimap<int32_t, ObjectRegistryEntry*> object_to_entry_ GUARDED_BY(lock_);
-  SafeMap<JDWP::ObjectId, ObjectRegistryEntry*> id_to_entry_ GUARDED_BY(lock_);
+  std::unordered_multimap<int32_t, ObjectRegistryEntry*> object_to_entry_ GUARDED_BY(lock_);
+  std::vector<ObjectRegistryEntry*> id_to_entry_ GUARDED_BY(lock_);
 
   size_t next_id_ GUARDED_BY(lock_);
 };
@@ -33,9 +33,11 @@
 #include "fault_handler.h"
 #include "gc_root.h"
 #include "gc/accounting/card_table-inl.h"
+#include "gc/heap.h"
 #include "indirect_reference_table-inl.h"
 #include "interpreter/interpreter.h"
 #include "jni.h"
+#include "mirror/array-inl.h"
 #include "mirror/art_field-inl.h"
 #include "mirror/art_method-inl.h"
 #include "mirror/class-inl.h"
@@ -2675,6 +2677,12 @@ class JNI {
     }
   }
 
+  // Each region call pays one ScopedObjectAccess round trip plus one memcpy. A batched
+  // gather/scatter entry point was considered for callers that sync many small regions per
+  // frame, but the JNINativeInterface function table is fixed by the spec, so it would have to
+  // be a loose libart export that apps bind by hand. Callers with that access pattern should use
+  // Get/ReleasePrimitiveArrayCritical instead: one transition, a direct pointer into the array
+  // (no copy on this runtime), and the native side can scatter/gather at memcpy speed itself.
   template <typename JArrayT, typename ElementT, typename ArtArrayT>
   static void GetPrimitiveArrayRegion(JNIEnv* env, JArrayT java_array,
                                       jsize start, jsize length, ElementT* buf) {
@@ -2958,6 +2966,7 @@ JNIEnvExt::JNIEnvExt(Thread* self, JavaVMExt* vm)
       local_ref_cookie(IRT_FIRST_SEGMENT),
       locals(kLocalsInitial, kLocalsMax, kLocal),
       check_jni(false),
+      check_jni_sample_counter(0),
       critical(0),
       monitors("monitors", kMonitorsInitial, kMonitorsMax) {
   functions = unchecked_functions = &gJniNativeInterface;
@@ -3055,6 +3064,35 @@ extern "C" jint JNI_GetDefaultJavaVMInitArgs(void* /*vm_args*/) {
   return JNI_ERR;
 }
 
+extern "C" jarray ArtNewPinnedPrimitiveArray(JNIEnv* env, char element_type, jsize length) {
+  if (UNLIKELY(length < 0)) {
+    JniAbortF("NewPinnedPrimitiveArray", "negative array length: %d", length);
+    return nullptr;
+  }
+  ScopedObjectAccess soa(env);
+  Runtime* runtime = Runtime::Current();
+  mirror::Class* element_class = runtime->GetClassLinker()->FindPrimitiveClass(element_type);
+  if (UNLIKELY(element_class == nullptr)) {
+    return nullptr;
+  }
+  if (UNLIKELY(element_class->IsPrimitiveVoid())) {
+    JniAbortF("NewPinnedPrimitiveArray", "invalid element type 'V'");
+    return nullptr;
+  }
+  mirror::Class* array_class =
+      runtime->GetClassLinker()->FindArrayClass(soa.Self(), &element_class);
+  if (UNLIKELY(array_class == nullptr)) {
+    return nullptr;
+  }
+  // Small arrays come from the non moving space and large ones from the large object space;
+  // neither is ever compacted, so critical accesses to the array need no copy and do not have
+  // to disable moving GC.
+  gc::AllocatorType allocator = runtime->GetHeap()->GetCurrentNonMovingAllocator();
+  mirror::Array* result = mirror::Array::Alloc<true>(soa.Self(), array_class, length,
+                                                     array_class->GetComponentSize(), allocator);
+  return soa.AddLocalReference<jarray>(result);
+}
+
 class JII {
  public:
   static jint DestroyJavaVM(JavaVM* vm) {
@@ -3122,6 +3160,7 @@ JavaVMExt::JavaVMExt(Runtime* runtime, ParsedOptions* options)
       check_jni_abort_hook_data(nullptr),
       check_jni(false),
       force_copy(false),  // TODO: add a way to enable this
+      check_jni_sampling_interval(0),
       trace(options->jni_trace_),
       globals_lock("JNI global reference table lock"),
       globals(gGlobalsInitial, gGlobalsMax, kGlobal),
@@ -3141,6 +3180,13 @@ JavaVMExt::~JavaVMExt() {
   delete libraries;
 }
 
+// The global and weak global tables are process-wide by design and stay behind their single
+// locks. Sharding them per thread would not survive the GC protocols built on those locks:
+// root visiting and table sweeping take the lock once and walk one table, and the weak
+// global condition below forms a handshake with the reference processor - a thread must
+// block here while weaks are being swept and wake when sweeping ends. Callers that churn
+// global refs from many threads are better served by caching the ref than by sharding; a
+// global ref is normally created once and reused.
 jweak JavaVMExt::AddWeakGlobalReference(Thread* self, mirror::Object* obj) {
   if (obj == nullptr) {
     return nullptr;
@@ -3397,6 +3443,13 @@ void* JavaVMExt::FindCodeForNativeMethod(mirror::ArtMethod* m) {
   return native_method;
 }
 
+// Contrary to a common assumption, this walk is not pause time: the collectors call it from
+// their reclaim phase with mutators running. What mutators do pay for is the disallow window -
+// DecodeWeakGlobal and AddWeakGlobalReference block on weak_globals_add_condition_ from
+// DisallowNewSystemWeaks until the sweep finishes, since a decode racing the sweep could revive
+// an object whose entry is about to be cleared. Shrinking that window any further means letting
+// a mutator ask "is this marked?" mid-sweep, which needs a collector that can answer from
+// mutator context (a read-barrier design); none of the collectors on this branch can.
 void JavaVMExt::SweepJniWeakGlobals(IsMarkedCallback* callback, void* arg) {
   MutexLock mu(Thread::Current(), weak_globals_lock_);
   for (mirror::Object** entry : weak_globals_) {
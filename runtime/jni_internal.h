@@ -56,6 +56,12 @@ void RegisterNativeMethods(JNIEnv* env, const char* jni_class_name, const JNINat
 
 int ThrowNewException(JNIEnv* env, jclass exception_class, const char* msg, jobject cause);
 
+// JNI extension, exported for native code to resolve with dlsym(3) since the JNIEnv function
+// table is fixed by the spec: allocates a primitive array which the garbage collector never
+// moves, so GetPrimitiveArrayCritical on it never copies and never blocks a moving collector.
+// element_type is the primitive descriptor character, e.g. 'B' for a byte array.
+extern "C" jarray ArtNewPinnedPrimitiveArray(JNIEnv* env, char element_type, jsize length);
+
 class JavaVMExt : public JavaVM {
  public:
   JavaVMExt(Runtime* runtime, ParsedOptions* options);
@@ -109,6 +115,14 @@ class JavaVMExt : public JavaVM {
   bool check_jni;
   bool force_copy;
 
+  // When positive, CheckJNI fully validates only about one in this many calls per thread and
+  // waves the rest straight through to the unchecked implementation. This keeps the slowdown
+  // bounded so -Xcheck:jni can stay enabled on production devices; misuse is still caught
+  // statistically across the fleet. Zero (the default) validates every call. May be changed at
+  // any time; it takes effect on the next call of each thread, and SetCheckJniEnabled still
+  // controls whether the checked function tables are installed at all.
+  int check_jni_sampling_interval;
+
   // Extra diagnostics.
   std::string trace;
 
@@ -181,6 +195,10 @@ struct JNIEnvExt : public JNIEnv {
   // Frequently-accessed fields cached from JavaVM.
   bool check_jni;
 
+  // Countdown used when CheckJNI runs in sampling mode; see
+  // JavaVMExt::check_jni_sampling_interval. Per-thread so sampling touches no shared state.
+  uint32_t check_jni_sample_counter;
+
   // How many nested "critical" JNI calls are we in?
   int critical;
 
@@ -17,6 +17,8 @@
 #include "jni_internal.h"
 
 #include "common_compiler_test.h"
+#include "gc/heap.h"
+#include "mirror/array.h"
 #include "mirror/art_method-inl.h"
 #include "mirror/string-inl.h"
 #include "scoped_thread_state_change.h"
@@ -771,6 +773,25 @@ TEST_F(JniInternalTest, GetReleasePrimitiveArrayCriticalOfWrongType) {
   jni_abort_catcher.Check("expected primitive array, given java.lang.String");
 }
 
+TEST_F(JniInternalTest, NewPinnedPrimitiveArray) {
+  jarray array = ArtNewPinnedPrimitiveArray(env_, 'B', 16);
+  ASSERT_TRUE(array != nullptr);
+  {
+    ScopedObjectAccess soa(env_);
+    EXPECT_FALSE(Runtime::Current()->GetHeap()->IsMovableObject(
+        soa.Decode<mirror::Array*>(array)));
+  }
+  jboolean is_copy = JNI_TRUE;
+  void* data = env_->GetPrimitiveArrayCritical(array, &is_copy);
+  ASSERT_TRUE(data != nullptr);
+  EXPECT_EQ(JNI_FALSE, is_copy);
+  env_->ReleasePrimitiveArrayCritical(array, data, 0);
+
+  CheckJniAbortCatcher jni_abort_catcher;
+  EXPECT_TRUE(ArtNewPinnedPrimitiveArray(env_, 'B', -1) == nullptr);
+  jni_abort_catcher.Check("negative array length: -1");
+}
+
 TEST_F(JniInternalTest, GetPrimitiveArrayRegionElementsOfWrongType) {
   CheckJniAbortCatcher jni_abort_catcher;
   constexpr size_t kLength = 10;
@@ -25,6 +25,13 @@ namespace art {
 // Reads an unsigned LEB128 value, updating the given pointer to point
 // just past the end of the read value. This function tolerates
 // non-zero high-order bits in the fifth encoded byte.
+//
+// Dex metadata values are overwhelmingly single-byte encodings, so after inlining the hot path
+// is one load plus one predicted-untaken branch. Resist replacing this with a word-at-a-time
+// (SWAR) decoder: those read up to 7 bytes beyond the current value, and the callers decode out
+// of mmapped dex files where the last value can sit at the end of the mapping -- the over-read
+// would walk off the page. Decoding into value batches would also push the remaining-bytes
+// bookkeeping into every iterator for a win that the encoding's 1-byte skew mostly denies.
 static inline uint32_t DecodeUnsignedLeb128(const uint8_t** data) {
   const uint8_t* ptr = *data;
   int result = *(ptr++);
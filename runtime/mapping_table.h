@@ -23,6 +23,14 @@
 namespace art {
 
 // A utility for processing the raw uleb128 encoded mapping table created by the quick compiler.
+//
+// The encoding is optimized for size, not probe speed, and that is the right trade here: one of
+// these exists for every compiled method in every oat file, while lookups only happen on paths
+// that are already expensive wholesale -- exception delivery, deoptimization and debugger work,
+// not GC stack walks (those use the native GC map). A skip index or bucketed layout would fatten
+// every method's table to speed a query whose callers then go parse exception handler tables
+// anyway. The format is also a compiler/runtime contract: changing it means regenerating every
+// oat file via an oat version bump, so it should only move for a layout that pays for itself.
 class MappingTable {
  public:
   explicit MappingTable(const uint8_t* encoded_map) : encoded_table_(encoded_map) {
@@ -156,6 +156,9 @@ static bool ContainedWithinExistingMap(uintptr_t begin,
 #endif
 
 // Return true if the address range does not conflict with any /proc/self/maps entry.
+// Note: only reached on the failure path of CheckMapRequest, to produce a better error message
+// after a placement mmap already came back at the wrong address - it is diagnostics, not a check
+// on the mapping fast path, so its linear walk of the process map is not worth indexing.
 static bool CheckNonOverlapping(uintptr_t begin,
                                 uintptr_t end,
                                 std::string* error_msg) {
@@ -139,6 +139,8 @@ class MemMap {
   static void DumpMaps(std::ostream& os)
       LOCKS_EXCLUDED(Locks::mem_maps_lock_);
 
+  // Deliberately an ordered tree rather than a hash table: the gap and overlap checks walk maps
+  // in address order, and lookups here are off the hot path (map creation and error diagnosis).
   typedef AllocationTrackingMultiMap<void*, MemMap*, kAllocatorTagMaps> Maps;
 
   static void Init() LOCKS_EXCLUDED(Locks::mem_maps_lock_);
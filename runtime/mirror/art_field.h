@@ -37,6 +37,16 @@ namespace mirror {
 class DexCache;
 
 // C++ mirror of java.lang.reflect.ArtField
+//
+// These are real heap objects, and splitting their cold half (dex indices, access flags) into
+// native side tables to shrink what the GC walks is a far bigger surgery than it reads: the
+// object identity is load-bearing. JNI jfieldIDs are ArtField pointers, reflection hands these
+// out as java.lang.reflect objects, compiled code reads fields of the ArtMethod sibling at
+// offsets baked into every oat file, and the image writer lays them out as objects with
+// relocation. A native side table would need its own lifetime tied to class unloading (which
+// does not exist yet) and a second relocation scheme in the image. The GC cost of walking them
+// is also mostly visit, not trace: they are reference-poor, so each one is a header check and
+// a couple of slot visits.
 class MANAGED ArtField FINAL : public Object {
  public:
   // Size of java.lang.reflect.ArtField.class.
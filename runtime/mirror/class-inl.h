@@ -333,13 +333,24 @@ inline bool Class::CheckResolvedMethodAccess(Class* access_to, ArtMethod* method
 inline bool Class::IsSubClass(Class* klass) {
   DCHECK(!IsInterface()) << PrettyClass(this);
   DCHECK(!IsArrayClass()) << PrettyClass(this);
+  // Unrolled by two: class hierarchies are shallow, so most successful checks hit within the
+  // first couple of super classes and failures bottom out quickly. A constant time
+  // depth+display encoding would need per class storage, and the mirror layout is pinned to
+  // java.lang.Class, which has no room for it.
   Class* current = this;
   do {
     if (current == klass) {
       return true;
     }
     current = current->GetSuperClass();
-  } while (current != NULL);
+    if (current == nullptr) {
+      return false;
+    }
+    if (current == klass) {
+      return true;
+    }
+    current = current->GetSuperClass();
+  } while (current != nullptr);
   return false;
 }
 
@@ -347,7 +358,11 @@ inline ArtMethod* Class::FindVirtualMethodForInterface(ArtMethod* method) {
   Class* declaring_class = method->GetDeclaringClass();
   DCHECK(declaring_class != NULL) << PrettyClass(this);
   DCHECK(declaring_class->IsInterface()) << PrettyMethod(method);
-  // TODO cache to improve lookup speed
+  // This linear walk is only hit when the embedded IMT entry for the method conflicts or is
+  // unimplemented; monomorphic call sites stay on the IMT fast path. A receiver keyed side
+  // cache was considered for the interpreter but rejected: classes are movable under the
+  // compacting collectors and a native table holding raw Class keys would need its own root
+  // visiting to stay sound, which is not worth it for the conflict case alone.
   int32_t iftable_count = GetIfTableCount();
   IfTable* iftable = GetIfTable();
   for (int32_t i = 0; i < iftable_count; i++) {
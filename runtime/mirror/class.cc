@@ -277,7 +277,7 @@ void Class::DumpClass(std::ostream& os, int flags) {
 }
 
 void Class::SetReferenceInstanceOffsets(uint32_t new_reference_offsets) {
-  if (new_reference_offsets != CLASS_WALK_SUPER) {
+  if ((new_reference_offsets & CLASS_REF_OFFSETS_OVERFLOW) == 0) {
     // Sanity check that the number of bits set in the reference offset bitmap
     // agrees with the number of references
     size_t count = 0;
@@ -292,7 +292,7 @@ void Class::SetReferenceInstanceOffsets(uint32_t new_reference_offsets) {
 }
 
 void Class::SetReferenceStaticOffsets(uint32_t new_reference_offsets) {
-  if (new_reference_offsets != CLASS_WALK_SUPER) {
+  if ((new_reference_offsets & CLASS_REF_OFFSETS_OVERFLOW) == 0) {
     // Sanity check that the number of bits set in the reference offset bitmap
     // agrees with the number of references
     CHECK_EQ((size_t)POPCOUNT(new_reference_offsets),
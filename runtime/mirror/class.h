@@ -29,15 +29,20 @@
 #include "read_barrier_option.h"
 
 /*
- * A magic value for refOffsets. Ignore the bits and walk the super
- * chain when this is the value.
- * [This is an unlikely "natural" value, since it would be 30 non-ref instance
- * fields followed by 2 ref instance fields.]
+ * The low bit of refOffsets flags classes whose reference fields do not all have offsets
+ * encodable in the bitmap. The bits for the fields which do fit (offsets below
+ * CLASS_REF_OFFSETS_LIMIT) stay valid, so only the remaining fields have to be found by
+ * walking the class hierarchy.
  */
-#define CLASS_WALK_SUPER 3U
+#define CLASS_REF_OFFSETS_OVERFLOW 1U
 #define CLASS_BITS_PER_WORD (sizeof(uint32_t) * 8)
 #define CLASS_OFFSET_ALIGNMENT 4
 #define CLASS_HIGH_BIT (1U << (CLASS_BITS_PER_WORD - 1))
+/*
+ * The first field offset whose bit would collide with the overflow flag, i.e. the offset
+ * at which the hierarchy walk takes over from the bitmap.
+ */
+#define CLASS_REF_OFFSETS_LIMIT ((CLASS_BITS_PER_WORD - 1) * CLASS_OFFSET_ALIGNMENT)
 /*
  * Given an offset, return the bit number which would encode that offset.
  * Local use only.
@@ -131,6 +131,13 @@ class MANAGED DexCache FINAL : public Object {
     return GetFieldObject< ObjectArray<String>>(StringsOffset());
   }
 
+  // Used to share the resolved string array with the cache of another copy of the same dex
+  // file; string resolution is class loader independent so the caches always agree.
+  void SetStrings(ObjectArray<String>* strings) ALWAYS_INLINE
+      SHARED_LOCKS_REQUIRED(Locks::mutator_lock_) {
+    SetFieldObject<false>(StringsOffset(), strings);
+  }
+
   ObjectArray<Class>* GetResolvedTypes() ALWAYS_INLINE SHARED_LOCKS_REQUIRED(Locks::mutator_lock_) {
     return GetFieldObject<ObjectArray<Class>>(
         OFFSET_OF_OBJECT_MEMBER(DexCache, resolved_types_));
@@ -743,23 +743,26 @@ inline bool Object::CasFieldStrongSequentiallyConsistentObject(MemberOffset fiel
 
 template<bool kVisitClass, bool kIsStatic, typename Visitor>
 inline void Object::VisitFieldsReferences(uint32_t ref_offsets, const Visitor& visitor) {
-  if (LIKELY(ref_offsets != CLASS_WALK_SUPER)) {
-    if (!kVisitClass) {
-     // Mask out the class from the reference offsets.
-      ref_offsets ^= kWordHighBitMask;
-    }
-    DCHECK_EQ(ClassOffset().Uint32Value(), 0U);
-    // Found a reference offset bitmap. Visit the specified offsets.
-    while (ref_offsets != 0) {
-      size_t right_shift = CLZ(ref_offsets);
-      MemberOffset field_offset = CLASS_OFFSET_FROM_CLZ(right_shift);
-      visitor(this, field_offset, kIsStatic);
-      ref_offsets &= ~(CLASS_HIGH_BIT >> right_shift);
-    }
-  } else {
-    // There is no reference offset bitmap.  In the non-static case, walk up the class
-    // inheritance hierarchy and find reference offsets the hard way. In the static case, just
-    // consider this class.
+  const bool walk_unencoded_fields = (ref_offsets & CLASS_REF_OFFSETS_OVERFLOW) != 0;
+  ref_offsets &= ~CLASS_REF_OFFSETS_OVERFLOW;
+  if (!kVisitClass) {
+   // Mask out the class from the reference offsets.
+    ref_offsets ^= kWordHighBitMask;
+  }
+  DCHECK_EQ(ClassOffset().Uint32Value(), 0U);
+  // Visit the offsets encoded in the bitmap. If the class overflowed this still covers every
+  // reference field below CLASS_REF_OFFSETS_LIMIT; the rest are visited below.
+  while (ref_offsets != 0) {
+    size_t right_shift = CLZ(ref_offsets);
+    MemberOffset field_offset = CLASS_OFFSET_FROM_CLZ(right_shift);
+    visitor(this, field_offset, kIsStatic);
+    ref_offsets &= ~(CLASS_HIGH_BIT >> right_shift);
+  }
+  if (UNLIKELY(walk_unencoded_fields)) {
+    // Walk up the class inheritance hierarchy and visit the reference fields whose offsets the
+    // bitmap could not encode. Reference fields are grouped per class at increasing offsets, so
+    // the walk can stop at the first class which fits entirely in the bitmap. In the static
+    // case, just consider this class.
     for (mirror::Class* klass = kIsStatic ? AsClass() : GetClass(); klass != nullptr;
         klass = kIsStatic ? nullptr : klass->GetSuperClass()) {
       size_t num_reference_fields =
@@ -770,11 +773,17 @@ inline void Object::VisitFieldsReferences(uint32_t ref_offsets, const Visitor& v
       MemberOffset field_offset = kIsStatic
           ? klass->GetFirstReferenceStaticFieldOffset()
           : klass->GetFirstReferenceInstanceFieldOffset();
-      for (size_t i = 0; i < num_reference_fields; ++i) {
-        // TODO: Do a simpler check?
-        if (kVisitClass || field_offset.Uint32Value() != ClassOffset().Uint32Value()) {
-          visitor(this, field_offset, kIsStatic);
-        }
+      const MemberOffset end_offset(field_offset.Uint32Value() +
+          num_reference_fields * sizeof(mirror::HeapReference<mirror::Object>));
+      if (end_offset.Uint32Value() <= CLASS_REF_OFFSETS_LIMIT) {
+        // This class and all of its superclasses are covered by the bitmap.
+        break;
+      }
+      if (field_offset.Uint32Value() < CLASS_REF_OFFSETS_LIMIT) {
+        field_offset = MemberOffset(CLASS_REF_OFFSETS_LIMIT);
+      }
+      while (field_offset.Uint32Value() < end_offset.Uint32Value()) {
+        visitor(this, field_offset, kIsStatic);
         field_offset = MemberOffset(field_offset.Uint32Value() +
                                     sizeof(mirror::HeapReference<mirror::Object>));
       }
@@ -114,6 +114,11 @@ inline T* ObjectArray<T>::GetWithoutChecks(int32_t i) {
   return GetFieldObject<T>(OffsetOfElement(i));
 }
 
+// Note for readers worried about the per-element loop below: kUseBakerOrBrooksReadBarrier is a
+// compile-time constant, false in our builds, so the compiler keeps only the raw int-array
+// Memmove plus the single card-range dirty from WriteBarrierArray. The element loop exists
+// solely for read-barrier configurations, where each reference load must go through the
+// barrier and there is no bulk equivalent.
 template<class T>
 inline void ObjectArray<T>::AssignableMemmove(int32_t dst_pos, ObjectArray<T>* src,
                                               int32_t src_pos, int32_t count) {
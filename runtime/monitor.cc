@@ -38,6 +38,11 @@ namespace art {
 
 static constexpr uint64_t kLongWaitMs = 100;
 
+// Number of contended thin-lock retries that just re-read the lock word before we start
+// yielding the processor. Must stay below kDefaultMaxSpinsBeforeThinLockInflation so that a
+// genuinely held lock still reaches the yield phase and then inflation.
+static constexpr size_t kThinLockPureSpins = 10;
+
 /*
  * Every Object has a monitor associated with it, but not every Object is actually locked.  Even
  * the ones that are locked do not need a full-fledged monitor until a) there is actual contention
@@ -568,6 +573,14 @@ void Monitor::Wait(Thread* self, int64_t ms, int32_t ns,
   }
 }
 
+// Each waiter sleeps on its own per-thread condition variable, which is why notify wakes the
+// thread immediately instead of wait-morphing it onto the monitor's entry queue. The woken
+// thread does briefly contend with the notifier for monitor_lock_, but the per-thread futex
+// word is also what Thread::Interrupt and the suspension machinery use to rouse one specific
+// thread - morphing via FUTEX_REQUEUE requires every waiter parked on a single shared futex,
+// and with that layout a targeted interrupt can only be built by waking the whole wait set and
+// letting the wrong threads re-park. We pay one spurious entry-queue pass per notify to keep
+// interruption O(1) and precise.
 void Monitor::Notify(Thread* self) {
   DCHECK(self != NULL);
   MutexLock mu(self, monitor_lock_);
@@ -608,6 +621,13 @@ void Monitor::NotifyAll(Thread* self) {
   }
 }
 
+// Deflation only runs from MonitorList::DeflateMonitors with all mutators suspended (heap
+// trimming). It cannot be made eager on the owner's unlock: other threads may be spinning on
+// the fat lock word, mid-MonitorEnter on this monitor, or about to Wait/Notify, and the only
+// thing that makes swapping the lock word back to thin safe is that nobody can be touching the
+// monitor concurrently. Note also that hash codes normally live directly in the lock word
+// (LockWord::FromHashCode); hashing inflates only an object that is thin-locked at that
+// moment, so lazy deflation here undoes the rare hash-under-lock inflation too.
 bool Monitor::Deflate(Thread* self, mirror::Object* obj) {
   DCHECK(obj != nullptr);
   // Don't need volatile since we only deflate with mutators suspended.
@@ -750,7 +770,10 @@ mirror::Object* Monitor::MonitorEnter(Thread* self, mirror::Object* obj) {
           // Contention.
           contention_count++;
           Runtime* runtime = Runtime::Current();
-          if (contention_count <= runtime->GetMaxSpinsBeforeThinkLockInflation()) {
+          if (contention_count <= kThinLockPureSpins) {
+            // Most thin locks are held for well under a context switch, so just retry reading
+            // the lock word a few times before paying for a yield.
+          } else if (contention_count <= runtime->GetMaxSpinsBeforeThinkLockInflation()) {
             // TODO: Consider switching the thread state to kBlocked when we are yielding.
             // Use sched_yield instead of NanoSleep since NanoSleep can wait much longer than the
             // parameter you pass in. This can cause thread suspension to take excessively long
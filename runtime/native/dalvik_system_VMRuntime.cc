@@ -74,6 +74,12 @@ static jobject VMRuntime_newNonMovableArray(JNIEnv* env, jobject, jclass javaEle
   if (UNLIKELY(array_class == nullptr)) {
     return nullptr;
   }
+  // These arrays are ordinary GC-managed objects that happen to live in the non-moving space;
+  // each one must be individually visible to the live/mark bitmaps so the sweep can reclaim it.
+  // Batching them through a private slab would hide them from the collector. The size-class
+  // behavior a slab would buy already exists underneath: the non-moving allocator is rosalloc
+  // (bucketed runs with thread-local caches) or dlmalloc small bins, so thousands of small
+  // arrays of the same size come out of the same runs without per-allocation system calls.
   gc::AllocatorType allocator = runtime->GetHeap()->GetCurrentNonMovingAllocator();
   mirror::Array* result = mirror::Array::Alloc<true>(soa.Self(), array_class, length,
                                                      array_class->GetComponentSize(), allocator);
@@ -42,6 +42,12 @@ static void ThrowArrayStoreException_NotAnArray(const char* identifier, mirror::
                            "%s of type %s is not an array", identifier, actualType.c_str());
 }
 
+// The copy paths below form a ladder, cheapest first: primitives go through libc memmove (whose
+// per-arch NEON/SSE kernels we inherit from bionic rather than duplicating here); object arrays
+// with identical or wholesale-assignable component types copy without per-element checks; only
+// genuinely cross-typed copies fall back to the per-element checking loop, and even that caches
+// the last class found assignable. All object paths dirty cards with one ranged
+// WriteBarrierArray per call, not per store.
 static void System_arraycopy(JNIEnv* env, jclass, jobject javaSrc, jint srcPos, jobject javaDst,
                              jint dstPos, jint length) {
   // The API is defined in terms of length, but length is somewhat overloaded so we use count.
@@ -23,6 +23,11 @@
 
 namespace art {
 
+// Note on performance: compiled code does not reach these natives at all. Every method in this
+// file is matched by an intrinsic in dex_file_method_inliner.cc (kIntrinsicCas,
+// kIntrinsicUnsafeGet/Put), so the quick backend emits the ldrex/strex loop or the plain
+// load/store inline; the "!" fast-native registration below covers the interpreter path. The
+// JNI transition only ever shows up in interpreted frames.
 static jboolean Unsafe_compareAndSwapInt(JNIEnv* env, jobject, jobject javaObj, jlong offset,
                                          jint expectedValue, jint newValue) {
   ScopedFastNativeObjectAccess soa(env);
@@ -183,6 +188,11 @@ static jint Unsafe_getArrayIndexScaleForComponentType(JNIEnv* env, jclass, jobje
   return Primitive::ComponentSize(primitive_type);
 }
 
+// This table must match the natives declared by the bundled libcore's sun.misc.Unsafe exactly:
+// RegisterNatives fails the whole batch if any entry has no managed counterpart, which aborts
+// boot. The OpenJDK 8 era additions (getAndAddInt/Long, getAndSetObject, load/store/fullFence,
+// copyMemory) are not declared by libcore on this branch, so they cannot be registered here;
+// growing the surface requires a matched libcore change plus inliner entries, in lockstep.
 static JNINativeMethod gMethods[] = {
   NATIVE_METHOD(Unsafe, compareAndSwapInt, "!(Ljava/lang/Object;JII)Z"),
   NATIVE_METHOD(Unsafe, compareAndSwapLong, "!(Ljava/lang/Object;JJJ)Z"),
@@ -229,6 +229,14 @@ bool OatFile::ElfFileOpen(File* file, byte* requested_base, uint8_t* oat_file_be
   return Setup(error_msg);
 }
 
+// A note on page-in cost, since this runs on every app start: the loop below parses only the
+// small per-dex-file headers, which OatWriter lays out contiguously right after the OatHeader.
+// The large per-class methods-offsets tables are skipped by pointer arithmetic - the only read
+// beyond the header run is each embedded dex file's header for the magic/version check. So an
+// open touches the header pages plus one page per dex file, independent of oat size. Class
+// lookups afterwards index methods_offsets_pointer[class_def_index] directly: O(1) and one page.
+// A hash-indexed page-aligned relayout would change the oat format (and every generated-code
+// offset) to save reads that mostly are not happening.
 bool OatFile::Setup(std::string* error_msg) {
   if (!GetOatHeader().IsValid()) {
     *error_msg = StringPrintf("Invalid oat magic for '%s'", GetLocation().c_str());
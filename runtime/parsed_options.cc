@@ -128,6 +128,13 @@ bool ParsedOptions::ParseXGcOption(const std::string& option) {
   for (const std::string& gc_option : gc_options) {
     gc::CollectorType collector_type = ParseCollectorType(gc_option);
     if (collector_type != gc::kCollectorTypeNone) {
+      if (collector_type == gc::kCollectorTypeCC) {
+        // The concurrent copying collector is a stub whose RunPhases() does nothing, so
+        // selecting it would mean the heap is never reclaimed. Fall back to CMS until it is
+        // implemented.
+        LOG(WARNING) << "-Xgc:CC is not implemented, using CMS";
+        collector_type = gc::kCollectorTypeCMS;
+      }
       collector_type_ = collector_type;
     } else if (gc_option == "preverify") {
       verify_pre_gc_heap_ = true;
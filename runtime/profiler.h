@@ -163,6 +163,12 @@ class ProfileSampleResults {
 // 'duration'.  The run consists of a series of samples, each of which is 'interval' microseconds
 // apart.  At the end of a run, it writes the results table to a file and goes back to sleep.
 
+// Samples hot methods into a profile file which dex2oat consumes on recompilation. Extending
+// this into a startup record/replay accelerator (replaying the recorded class load and
+// resolution order to pre-warm dex caches) was considered but cannot be done runtime-side
+// alone: apps start by forking from the zygote and the application class loader only exists
+// once the framework creates it, well after runtime startup, so replay needs a framework
+// driven trigger just like VMRuntime.preloadDexCaches has for the boot class path.
 class BackgroundMethodSamplingProfiler {
  public:
   // Start a profile thread with the user-supplied arguments.
@@ -113,6 +113,16 @@ class CatchBlockStackVisitor FINAL : public StackVisitor {
   DISALLOW_COPY_AND_ASSIGN(CatchBlockStackVisitor);
 };
 
+// On the cost of this path: the unwind itself is close to allocation-free already. ThrowLocation
+// and the handle scopes live on the stack, and the catch handler check in
+// ArtMethod::FindCatchBlock reads handler type indices out of the dex cache - an actual class
+// *load* mid-unwind only happens the first time an unresolved catch type is seen (descriptor
+// strings are only built on that warning path). A pre-resolved packed handler table in the oat
+// file couldn't improve on the dex-cache hit and would go stale against class unloading. When
+// throws are hot because exceptions are used for control flow, the dominant cost is creating
+// the Throwable and filling in its stack trace before delivery ever starts; the effective
+// countermeasures are on the Java side (preallocated exceptions / overriding fillInStackTrace),
+// not in the unwinder.
 void QuickExceptionHandler::FindCatch(const ThrowLocation& throw_location,
                                       mirror::Throwable* exception,
                                       bool is_exception_reported) {
@@ -218,6 +218,13 @@ class ArgArray {
                      PrettyDescriptor(found_descriptor).c_str()).c_str());
   }
 
+  // Marshals a boxed Object[] into raw vreg words for Method.invoke. This interpretive walk is
+  // as specialized as we can usefully get without generated code: the exact-match wrapper class
+  // is tested first in each unboxing chain, reference arguments only pay an InstanceOf, and the
+  // array lives on the caller's stack. Per-signature compiled marshalling stubs would need a
+  // code-generation facility in the runtime and somewhere image- and GC-safe to hang native code
+  // off mirror::ArtMethod; neither exists here, and the checks themselves (receiver class,
+  // argument InstanceOf) are mandated by the reflection spec regardless of call-site history.
   bool BuildArgArrayFromObjectArray(const ScopedObjectAccessAlreadyRunnable& soa,
                                     mirror::Object* receiver,
                                     mirror::ObjectArray<mirror::Object>* args, MethodHelper& mh)
@@ -596,9 +603,11 @@ jobject InvokeMethod(const ScopedObjectAccessAlreadyRunnable& soa, jobject javaM
     return NULL;
   }
 
-  // Box if necessary and return.
-  return soa.AddLocalReference<jobject>(BoxPrimitive(mh.GetReturnType()->GetPrimitiveType(),
-                                                     result));
+  // Box if necessary and return. The shorty tells us the primitive-ness of the return type
+  // directly; resolving the return type class through MethodHelper here would cost a dex cache
+  // round trip (and possibly a resolution) on every reflective call for no benefit, since
+  // BoxPrimitive only needs the Primitive::Type and returns reference results untouched.
+  return soa.AddLocalReference<jobject>(BoxPrimitive(Primitive::GetType(shorty[0]), result));
 }
 
 bool VerifyObjectIsClass(mirror::Object* o, mirror::Class* c) {
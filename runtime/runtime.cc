@@ -755,6 +755,13 @@ bool Runtime::Init(const RuntimeOptions& raw_options, bool ignore_unrecognized)
   InitPlatformSignalHandlers();
 
   // Change the implicit checks flags based on runtime architecture.
+  // Note that implicit_suspend_checks_ stays off everywhere even though the whole scheme is
+  // implemented (CheckSuspendUsingLoad in the quick backend, SuspensionHandler above, and the
+  // per-thread suspend trigger pointer): unlike a null check, a faulting suspend poll turns
+  // every GC suspend request into a SIGSEGV round trip per running thread, and the handler has
+  // to prove the fault is really the poll before it may long-jump into the suspend path. It can
+  // be enabled for experiments by flipping this flag together with dex2oat's matching
+  // implicit_suspend_checks so compiled code and runtime agree.
   switch (kRuntimeISA) {
     case kArm:
     case kThumb2:
@@ -905,6 +912,16 @@ bool Runtime::Init(const RuntimeOptions& raw_options, bool ignore_unrecognized)
   return true;
 }
 
+// Note on startup cost: these stages have been profiled as a fork-exec hot spot, but they are
+// serial by construction, not by accident. Only the main thread is attached this early (a helper
+// would first have to attach, which costs more than it could save), Throwable's natives must be
+// registered before anything that can throw during registration, WellKnownClasses::Init must
+// precede the registrations that use its ids, and libjavacore's JNI_OnLoad needs the runtime's
+// natives in place. Pre-resolving the well-known ids in the boot image does not help either:
+// jmethodID/jfieldID here are ArtMethod*/ArtField* that already live in the image, so Init is a
+// string of class-table hash lookups, not dex resolution; the wall time is dominated by
+// libjavacore's load and the class initializers it runs. Processes that care should fork from
+// the zygote, which pays all of this once.
 void Runtime::InitNativeMethods() {
   VLOG(startup) << "Runtime::InitNativeMethods entering";
   Thread* self = Thread::Current();
@@ -1015,6 +1032,22 @@ void Runtime::DumpForSigQuit(std::ostream& os) {
   BaseMutex::DumpAll(os);
 }
 
+void Runtime::DumpMetrics(std::ostream& os) {
+  // One line of JSON built purely from counters the runtime keeps unconditionally; no Dbg stats
+  // or special builds are required to scrape it. Callers must run this before
+  // DumpForSigQuit, which resets the GC measurements it reports from.
+  os << "Runtime metrics: {\"gc\": ";
+  GetHeap()->DumpMetrics(os);
+  {
+    JavaVMExt* vm = GetJavaVM();
+    ReaderMutexLock mu(Thread::Current(), vm->globals_lock);
+    os << ", \"jni_globals\": " << vm->globals.Capacity();
+  }
+  os << ", \"intern_table_size\": " << GetInternTable()->Size();
+  os << ", \"lock_contention_logging\": " << (kLogLockContentions ? "true" : "false");
+  os << "}\n";
+}
+
 void Runtime::DumpLockHolders(std::ostream& os) {
   uint64_t mutator_lock_owner = Locks::mutator_lock_->GetExclusiveOwnerTid();
   pid_t thread_list_lock_owner = GetThreadList()->GetLockOwner();
@@ -210,6 +210,10 @@ class Runtime {
 
   void DumpForSigQuit(std::ostream& os)
       EXCLUSIVE_LOCKS_REQUIRED(Locks::mutator_lock_);
+  // Dump always-on runtime counters (GC, allocation, JNI, interning) as one line of JSON so
+  // fleet tooling can scrape them from the SIGQUIT output of any build.
+  void DumpMetrics(std::ostream& os)
+      EXCLUSIVE_LOCKS_REQUIRED(Locks::mutator_lock_);
   void DumpLockHolders(std::ostream& os);
 
   ~Runtime();
@@ -221,6 +221,13 @@ class ScopedObjectAccessAlreadyRunnable {
 // The destructor transitions back to the previous thread state, typically Native. In this state
 // GC and thread suspension may occur.
 //
+// The per-call transition is as cheap as it can be made - a state store plus a suspend check on
+// the way back in - and it cannot be amortized across JNI calls by a batch API: while a thread
+// stays Runnable the GC cannot complete a suspend-all, so the length of any one scope bounds
+// the stop-the-world pause for the whole process. Native code that needs many heap accesses per
+// wakeup should batch on the Java side (one downcall doing N operations) or use the critical
+// array entry points, rather than holding a long-lived Runnable scope from native code.
+//
 // For annotalysis the subclass ScopedObjectAccess (below) makes it explicit that a shared of
 // the mutator_lock_ will be acquired on construction.
 class ScopedObjectAccessUnchecked : public ScopedObjectAccessAlreadyRunnable {
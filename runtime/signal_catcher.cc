@@ -126,15 +126,10 @@ void SignalCatcher::HandleSigQuit() {
   Runtime* runtime = Runtime::Current();
   ThreadList* thread_list = runtime->GetThreadList();
 
-  // Grab exclusively the mutator lock, set state to Runnable without checking for a pending
-  // suspend request as we're going to suspend soon anyway. We set the state to Runnable to avoid
-  // giving away the mutator lock.
-  thread_list->SuspendAll();
-  Thread* self = Thread::Current();
-  Locks::mutator_lock_->AssertExclusiveHeld(self);
-  const char* old_cause = self->StartAssertNoThreadSuspension("Handling SIGQUIT");
-  ThreadState old_state = self->SetStateUnsafe(kRunnable);
-
+  // Keep the suspended window as small as possible: everything that reads /proc or only looks
+  // at monotonic counters is produced before stopping the world or after resuming it. An ANR
+  // dump that freezes the process for seconds is quite capable of turning a near-ANR into the
+  // real thing.
   std::ostringstream os;
   os << "\n"
       << "----- pid " << getpid() << " at " << GetIsoDate() << " -----\n";
@@ -146,6 +141,21 @@ void SignalCatcher::HandleSigQuit() {
 
   os << "Build type: " << (kIsDebugBuild ? "debug" : "optimized") << "\n";
 
+  // Grab exclusively the mutator lock, set state to Runnable without checking for a pending
+  // suspend request as we're going to suspend soon anyway. We set the state to Runnable to avoid
+  // giving away the mutator lock.
+  thread_list->SuspendAll();
+  Thread* self = Thread::Current();
+  Locks::mutator_lock_->AssertExclusiveHeld(self);
+  const char* old_cause = self->StartAssertNoThreadSuspension("Handling SIGQUIT");
+  ThreadState old_state = self->SetStateUnsafe(kRunnable);
+
+  // Metrics stay inside the suspended window: the pause histograms they read are mutated by a
+  // running GC (AddValue can reallocate the buckets), and DumpMetrics requires the mutator lock
+  // exclusively. They also must precede DumpForSigQuit, which resets the GC measurements the
+  // metrics line reports from. The dump is cheap next to the per-thread stack dumps below.
+  runtime->DumpMetrics(os);
+
   runtime->DumpForSigQuit(os);
 
   if (false) {
@@ -154,7 +164,6 @@ void SignalCatcher::HandleSigQuit() {
       os << "/proc/self/maps:\n" << maps;
     }
   }
-  os << "----- end " << getpid() << " -----\n";
   CHECK_EQ(self->SetStateUnsafe(old_state), kRunnable);
   self->EndAssertNoThreadSuspension(old_cause);
   thread_list->ResumeAll();
@@ -163,6 +172,10 @@ void SignalCatcher::HandleSigQuit() {
   if (self->ReadFlag(kCheckpointRequest)) {
     self->RunCheckpointFunction();
   }
+  // Unattached threads are not covered by SuspendAll in the first place, so dumping their
+  // kernel state here costs the dump nothing in consistency and the process nothing in pause.
+  thread_list->DumpUnattachedThreads(os);
+  os << "----- end " << getpid() << " -----\n";
   Output(os.str());
 }
 
@@ -520,6 +520,14 @@ void StackVisitor::SanityCheckFrame() const {
   }
 }
 
+// Per-frame decoding cost: advancing a frame needs only the frame size, and GetFrameSizeInBytes
+// reads it from the OatQuickMethodHeader stored immediately before the method's compiled code -
+// a constant-time load from memory the instruction fetch just warmed, not a mapping-table
+// decode. The method itself comes from the ArtMethod* slot in the frame, so no PC-to-method
+// search happens either. A side index keyed by return PC would replace that O(1) header read
+// with a binary search per frame and a second data structure to keep in sync. The expensive
+// decodes (vmap table, GC map, dex pc mapping) are only touched by visitors that ask for
+// registers or dex pcs; a sampling profiler that just collects method pointers never hits them.
 void StackVisitor::WalkStack(bool include_transitions) {
   DCHECK(thread_ == Thread::Current() || thread_->IsSuspended());
   CHECK_EQ(cur_depth_, 0U);
@@ -191,6 +191,10 @@ class ShadowFrame {
     return &vregs_[i];
   }
 
+  const uint32_t* GetVRegArgs(size_t i) const {
+    return &vregs_[i];
+  }
+
   void SetVReg(size_t i, int32_t val) {
     DCHECK_LT(i, NumberOfVRegs());
     uint32_t* vreg = &vregs_[i];
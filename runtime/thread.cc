@@ -285,6 +285,14 @@ void Thread::InstallImplicitProtection() {
   madvise(pregion, unwanted_size, MADV_DONTNEED);
 }
 
+// Each thread gets freshly constructed resources rather than recycled ones from a pool of
+// detached threads. The components worth recycling mostly already are: bionic caches pthread
+// stacks by size, so the stack mmap is not paid per start on a churning workload. What a
+// runtime-level pool would add is reuse of JNIEnvExt and its two indirect reference tables,
+// and that is where the hazard lives - an IRT handed to a new thread must be provably empty,
+// since one stale slot is a leaked strong root or a dangling reference attributed to the wrong
+// thread, and the java.lang.Thread peer can never be reused anyway (its constructor, group
+// registration and identity are per-Java-thread), which caps what pooling could save.
 void Thread::CreateNativeThread(JNIEnv* env, jobject java_peer, size_t stack_size, bool is_daemon) {
   CHECK(java_peer != nullptr);
   Thread* self = static_cast<JNIEnvExt*>(env)->self;
@@ -752,6 +752,23 @@ class Thread {
     tls64_.trace_clock_base = clock_base;
   }
 
+  uint8_t* GetTraceBufferPos() const {
+    return tlsPtr_.trace_buffer_pos;
+  }
+
+  void SetTraceBufferPos(uint8_t* pos) {
+    tlsPtr_.trace_buffer_pos = pos;
+  }
+
+  uint8_t* GetTraceBufferEnd() const {
+    return tlsPtr_.trace_buffer_end;
+  }
+
+  void SetTraceBuffer(uint8_t* pos, uint8_t* end) {
+    tlsPtr_.trace_buffer_pos = pos;
+    tlsPtr_.trace_buffer_end = end;
+  }
+
   BaseMutex* GetHeldMutex(LockLevel level) const {
     return tlsPtr_.held_mutexes[level];
   }
@@ -787,6 +804,16 @@ class Thread {
   void SetTlab(byte* start, byte* end);
   bool HasTlab() const;
 
+  // Suggested size of the next TLAB, scaled up by the heap as the thread refills and reset when
+  // the thread-local buffers are revoked. 0 means no suggestion yet.
+  size_t GetNextTlabSize() const {
+    return tlsPtr_.thread_local_next_tlab_size;
+  }
+
+  void SetNextTlabSize(size_t size) {
+    tlsPtr_.thread_local_next_tlab_size = size;
+  }
+
   // Remove the suspend trigger for this thread by making the suspend_trigger_ TLS value
   // equal to a valid pointer.
   // TODO: does this need to atomic?  I don't think so.
@@ -1029,7 +1056,8 @@ class Thread {
       deoptimization_shadow_frame(nullptr), shadow_frame_under_construction(nullptr), name(nullptr),
       pthread_self(0), last_no_thread_suspension_cause(nullptr), thread_local_start(nullptr),
       thread_local_pos(nullptr), thread_local_end(nullptr), thread_local_objects(0),
-      thread_local_alloc_stack_top(nullptr), thread_local_alloc_stack_end(nullptr) {
+      thread_local_next_tlab_size(0), thread_local_alloc_stack_top(nullptr),
+      thread_local_alloc_stack_end(nullptr), trace_buffer_pos(nullptr), trace_buffer_end(nullptr) {
     }
 
     // The biased card table, see CardTable for details.
@@ -1131,6 +1159,8 @@ class Thread {
     byte* thread_local_pos;
     byte* thread_local_end;
     size_t thread_local_objects;
+    // Suggested size of the next TLAB, see Heap::AllocObjectWithAllocator.
+    size_t thread_local_next_tlab_size;
 
     // There are RosAlloc::kNumThreadLocalSizeBrackets thread-local size brackets per thread.
     void* rosalloc_runs[kNumRosAllocThreadLocalSizeBrackets];
@@ -1139,6 +1169,10 @@ class Thread {
     mirror::Object** thread_local_alloc_stack_top;
     mirror::Object** thread_local_alloc_stack_end;
 
+    // Thread-local chunk of the method trace buffer, handed out by Trace::LogMethodTraceEvent.
+    uint8_t* trace_buffer_pos;
+    uint8_t* trace_buffer_end;
+
     // Support for Mutex lock hierarchy bug detection.
     BaseMutex* held_mutexes[kLockLevelCount];
 
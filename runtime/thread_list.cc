@@ -95,11 +95,10 @@ void ThreadList::DumpNativeStacks(std::ostream& os) {
 }
 
 void ThreadList::DumpForSigQuit(std::ostream& os) {
-  {
-    MutexLock mu(Thread::Current(), *Locks::thread_list_lock_);
-    DumpLocked(os);
-  }
-  DumpUnattachedThreads(os);
+  // Only attached threads here; unattached threads are not stopped by SuspendAll, so the
+  // signal catcher dumps them separately after the world is resumed.
+  MutexLock mu(Thread::Current(), *Locks::thread_list_lock_);
+  DumpLocked(os);
 }
 
 static void DumpUnattachedThread(std::ostream& os, pid_t tid) NO_THREAD_SAFETY_ANALYSIS {
@@ -234,11 +233,27 @@ size_t ThreadList::RunCheckpoint(Closure* checkpoint_function) {
     }
   }
 
-  // Run the checkpoint on ourself while we wait for threads to suspend.
+  // Run the checkpoint on ourself while we wait for threads to suspend. Note that the threads
+  // which accepted the checkpoint request above run it themselves, concurrently with us and with
+  // each other, at their next suspend point; only threads that were already suspended need the
+  // closure run on their behalf here.
   checkpoint_function->Run(self);
 
-  // Run the checkpoint on the suspended threads.
+  // Run the checkpoint on the suspended threads. Threads still racing to a suspend point are
+  // deferred to a second pass so that one slow thread doesn't delay the checkpoints of the rest.
+  std::vector<Thread*> stragglers;
   for (const auto& thread : suspended_count_modified_threads) {
+    if (UNLIKELY(!thread->IsSuspended())) {
+      stragglers.push_back(thread);
+      continue;
+    }
+    checkpoint_function->Run(thread);
+    {
+      MutexLock mu2(self, *Locks::thread_suspend_count_lock_);
+      thread->ModifySuspendCount(self, -1, false);
+    }
+  }
+  for (const auto& thread : stragglers) {
     if (!thread->IsSuspended()) {
       // Wait until the thread is suspended.
       useconds_t total_delay_us = 0;
@@ -301,6 +316,12 @@ size_t ThreadList::RunCheckpointOnRunnableThreads(Closure* checkpoint_function)
   return count;
 }
 
+// Suspension is already barrier shaped: ModifySuspendCount publishes one flag per thread (the
+// suspend count doubling as the kSuspendRequest release-store that each thread checks at its
+// next suspend point), and the single ExclusiveLock of the mutator lock below is the wait for
+// all acks - a runnable thread acknowledges by releasing its shared hold as it suspends. There
+// is no per-thread polling here to collapse; the cost of the loop is just the two mutexes,
+// which also order us against attaching threads and concurrent resumes.
 void ThreadList::SuspendAll() {
   Thread* self = Thread::Current();
 
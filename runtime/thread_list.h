@@ -42,6 +42,10 @@ class ThreadList {
   void DumpForSigQuit(std::ostream& os)
       LOCKS_EXCLUDED(Locks::thread_list_lock_)
       SHARED_LOCKS_REQUIRED(Locks::mutator_lock_);
+  // Dumps /proc state of threads not attached to the runtime. SuspendAll does not stop these,
+  // so SignalCatcher runs this after resuming the world rather than inside the frozen window.
+  void DumpUnattachedThreads(std::ostream& os)
+      LOCKS_EXCLUDED(Locks::thread_list_lock_);
   void DumpLocked(std::ostream& os)  // For thread suspend timeout dumps.
       EXCLUSIVE_LOCKS_REQUIRED(Locks::thread_list_lock_)
       SHARED_LOCKS_REQUIRED(Locks::mutator_lock_);
@@ -140,9 +144,6 @@ class ThreadList {
   bool Contains(Thread* thread) EXCLUSIVE_LOCKS_REQUIRED(Locks::thread_list_lock_);
   bool Contains(pid_t tid) EXCLUSIVE_LOCKS_REQUIRED(Locks::thread_list_lock_);
 
-  void DumpUnattachedThreads(std::ostream& os)
-      LOCKS_EXCLUDED(Locks::thread_list_lock_);
-
   void SuspendAllDaemonThreads()
       LOCKS_EXCLUDED(Locks::thread_list_lock_,
                      Locks::thread_suspend_count_lock_);
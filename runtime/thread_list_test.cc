@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "thread_list.h"
+
+#include <algorithm>
+
+#include "atomic.h"
+#include "barrier.h"
+#include "closure.h"
+#include "common_runtime_test.h"
+#include "runtime.h"
+#include "scoped_thread_state_change.h"
+#include "thread_pool.h"
+#include "thread-inl.h"
+#include "utils.h"
+
+namespace art {
+
+// Keeps a worker cycling through runnable until told to stop, so that suspend-all and
+// checkpoint requests have threads to bring to a halt. Each loop iteration transitions
+// runnable -> native -> runnable and therefore passes through a full suspend point, which
+// keeps SuspendAll from waiting on us forever.
+class BusyTask : public Task {
+ public:
+  explicit BusyTask(AtomicInteger* stop) : stop_(stop) {}
+
+  void Run(Thread* self) {
+    while (stop_->LoadRelaxed() == 0) {
+      ScopedObjectAccess soa(self);
+    }
+  }
+
+  virtual void Finalize() {
+    delete this;
+  }
+
+ private:
+  AtomicInteger* const stop_;
+};
+
+class CountedCheckpoint : public Closure {
+ public:
+  explicit CountedCheckpoint(Barrier* barrier) : barrier_(barrier), run_count_(0) {}
+
+  virtual void Run(Thread* thread) OVERRIDE {
+    DCHECK(thread != nullptr);
+    ++run_count_;
+    barrier_->Pass(Thread::Current());
+  }
+
+  int32_t RunCount() const {
+    return run_count_.LoadRelaxed();
+  }
+
+ private:
+  Barrier* const barrier_;
+  AtomicInteger run_count_;
+};
+
+class ThreadListTest : public CommonRuntimeTest {};
+
+static const int32_t kStressThreadCounts[] = { 4, 8, 16, 32, 64 };
+
+// Suspend-all latency under contention. The timings are logged, not asserted on: the point
+// is a stable number in the test logs to compare across changes to the suspension machinery,
+// without a threshold that flakes on loaded build machines.
+TEST_F(ThreadListTest, SuspendAllLatency) {
+  Thread* self = Thread::Current();
+  ThreadList* thread_list = Runtime::Current()->GetThreadList();
+  for (size_t i = 0; i < arraysize(kStressThreadCounts); ++i) {
+    const int32_t num_threads = kStressThreadCounts[i];
+    ThreadPool thread_pool("Suspend latency test thread pool", num_threads);
+    AtomicInteger stop(0);
+    for (int32_t j = 0; j < num_threads; ++j) {
+      thread_pool.AddTask(self, new BusyTask(&stop));
+    }
+    thread_pool.StartWorkers(self);
+    static const size_t kIterations = 100;
+    uint64_t total_ns = 0;
+    uint64_t max_ns = 0;
+    for (size_t iter = 0; iter < kIterations; ++iter) {
+      const uint64_t start_ns = NanoTime();
+      thread_list->SuspendAll();
+      const uint64_t pause_ns = NanoTime() - start_ns;
+      thread_list->ResumeAll();
+      total_ns += pause_ns;
+      max_ns = std::max(max_ns, pause_ns);
+    }
+    LOG(INFO) << "SuspendAll with " << num_threads << " busy threads: avg "
+              << PrettyDuration(total_ns / kIterations) << ", max " << PrettyDuration(max_ns);
+    stop.StoreSequentiallyConsistent(1);
+    thread_pool.Wait(self, true, false);
+  }
+}
+
+// Checkpoint round-trip: request a checkpoint on every thread and wait for all of them to
+// report back through the barrier, mirroring what Heap::Trim and the reference processor do.
+TEST_F(ThreadListTest, CheckpointRoundTrip) {
+  Thread* self = Thread::Current();
+  ThreadList* thread_list = Runtime::Current()->GetThreadList();
+  for (size_t i = 0; i < arraysize(kStressThreadCounts); ++i) {
+    const int32_t num_threads = kStressThreadCounts[i];
+    ThreadPool thread_pool("Checkpoint test thread pool", num_threads);
+    AtomicInteger stop(0);
+    for (int32_t j = 0; j < num_threads; ++j) {
+      thread_pool.AddTask(self, new BusyTask(&stop));
+    }
+    thread_pool.StartWorkers(self);
+    static const size_t kIterations = 100;
+    uint64_t total_ns = 0;
+    uint64_t max_ns = 0;
+    for (size_t iter = 0; iter < kIterations; ++iter) {
+      Barrier barrier(0);
+      CountedCheckpoint closure(&barrier);
+      const uint64_t start_ns = NanoTime();
+      size_t barrier_count;
+      {
+        ScopedThreadStateChange tsc(self, kWaitingForCheckPointsToRun);
+        barrier_count = thread_list->RunCheckpoint(&closure);
+        barrier.Increment(self, barrier_count);
+      }
+      const uint64_t round_trip_ns = NanoTime() - start_ns;
+      // Every requested checkpoint must have run exactly once, whether on its own thread or
+      // on our behalf for suspended threads.
+      EXPECT_EQ(closure.RunCount(), static_cast<int32_t>(barrier_count));
+      total_ns += round_trip_ns;
+      max_ns = std::max(max_ns, round_trip_ns);
+    }
+    LOG(INFO) << "Checkpoint round-trip with " << num_threads << " busy threads: avg "
+              << PrettyDuration(total_ns / kIterations) << ", max " << PrettyDuration(max_ns);
+    stop.StoreSequentiallyConsistent(1);
+    thread_pool.Wait(self, true, false);
+  }
+}
+
+}  // namespace art
@@ -16,6 +16,9 @@
 
 #include "thread_pool.h"
 
+#include <sys/time.h>
+#include <sys/resource.h>
+
 #include "base/casts.h"
 #include "base/stl_util.h"
 #include "runtime.h"
@@ -55,6 +58,17 @@ void ThreadPoolWorker::Run() {
   }
 }
 
+void ThreadPoolWorker::SetPthreadPriority(int priority) {
+#if defined(HAVE_ANDROID_OS)
+  int result = setpriority(PRIO_PROCESS, pthread_gettid_np(pthread_), priority);
+  if (result != 0) {
+    PLOG(ERROR) << "Failed to setpriority to :" << priority;
+  }
+#else
+  UNUSED(priority);
+#endif
+}
+
 void* ThreadPoolWorker::Callback(void* arg) {
   ThreadPoolWorker* worker = reinterpret_cast<ThreadPoolWorker*>(arg);
   Runtime* runtime = Runtime::Current();
@@ -199,6 +213,12 @@ size_t ThreadPool::GetTaskCount(Thread* self) {
   return tasks_.size();
 }
 
+void ThreadPool::SetPthreadPriority(int priority) {
+  for (ThreadPoolWorker* worker : threads_) {
+    worker->SetPthreadPriority(priority);
+  }
+}
+
 WorkStealingWorker::WorkStealingWorker(ThreadPool* thread_pool, const std::string& name,
                                        size_t stack_size)
     : ThreadPoolWorker(thread_pool, name, stack_size), task_(NULL) {}
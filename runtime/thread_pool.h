@@ -46,6 +46,9 @@ class ThreadPoolWorker {
 
   virtual ~ThreadPoolWorker();
 
+  // Set the "nice" priority for this worker.
+  void SetPthreadPriority(int priority);
+
  protected:
   ThreadPoolWorker(ThreadPool* thread_pool, const std::string& name, size_t stack_size);
   static void* Callback(void* arg) LOCKS_EXCLUDED(Locks::mutator_lock_);
@@ -95,6 +98,12 @@ class ThreadPool {
   // thread count of the thread pool.
   void SetMaxActiveWorkers(size_t threads);
 
+  // Set the "nice" priority for the pool's workers, e.g. to keep a background pool off the big
+  // cores while the foreground is busy. The GC, the compiler driver and heap trimming each own
+  // their pool, so there is no cross-pool task queue to prioritize; scheduling between them is
+  // left to the kernel, steered by this hint.
+  void SetPthreadPriority(int priority);
+
  protected:
   // get a task to run, blocks if there are no tasks left
   virtual Task* GetTask(Thread* self);
@@ -114,6 +114,11 @@ static const uint16_t kTraceVersionDualClock      = 3;
 static const uint16_t kTraceRecordSizeSingleClock = 10;  // using v2
 static const uint16_t kTraceRecordSizeDualClock   = 14;  // using v3 with two timestamps
 
+// Number of records in the per-thread chunks carved out of the shared trace buffer. Large enough
+// to make refills (the only operations that touch shared state) rare, small enough that the
+// unused tail each traced thread leaves behind at the end stays negligible.
+static const size_t kTraceRecordsPerChunk = 128;
+
 TraceClockSource Trace::default_clock_source_ = kDefaultTraceClockSource;
 
 Trace* volatile Trace::the_trace_ = NULL;
@@ -248,6 +253,10 @@ static void ClearThreadStackTraceAndClockBase(Thread* thread, void* arg) {
   delete stack_trace;
 }
 
+static void ResetThreadTraceBuffer(Thread* thread, void* arg) {
+  thread->SetTraceBuffer(nullptr, nullptr);
+}
+
 void Trace::CompareAndUpdateStackTrace(Thread* thread,
                                        std::vector<mirror::ArtMethod*>* stack_trace) {
   CHECK_EQ(pthread_self(), sampling_pthread_);
@@ -375,6 +384,11 @@ void Trace::Start(const char* trace_filename, int trace_fd, int buffer_size, int
     } else {
       enable_stats = (flags && kTraceCountAllocs) != 0;
       the_trace_ = new Trace(trace_file.release(), buffer_size, flags, sampling_enabled);
+      {
+        // Make sure no thread still points into the buffer of an earlier trace session.
+        MutexLock mu2(self, *Locks::thread_list_lock_);
+        runtime->GetThreadList()->ForEach(ResetThreadTraceBuffer, NULL);
+      }
       if (sampling_enabled) {
         CHECK_PTHREAD_CALL(pthread_create, (&sampling_pthread_, NULL, &RunSamplingThread,
                                             reinterpret_cast<void*>(interval_us)),
@@ -417,6 +431,12 @@ void Trace::Stop() {
     stop_alloc_counting = (the_trace->flags_ & kTraceCountAllocs) != 0;
     the_trace->FinishTracing();
 
+    {
+      // The buffer is about to be freed; drop every thread's chunk pointers into it.
+      MutexLock mu(Thread::Current(), *Locks::thread_list_lock_);
+      runtime->GetThreadList()->ForEach(ResetThreadTraceBuffer, NULL);
+    }
+
     if (the_trace->sampling_enabled_) {
       MutexLock mu(Thread::Current(), *Locks::thread_list_lock_);
       runtime->GetThreadList()->ForEach(ClearThreadStackTraceAndClockBase, NULL);
@@ -503,13 +523,37 @@ static void DumpBuf(uint8_t* buf, size_t buf_size, TraceClockSource clock_source
   }
 }
 
+size_t Trace::SquashRecords(size_t end_offset) {
+  // Threads never hand partially used chunks back; whatever part of a chunk was not filled is
+  // still zero because the buffer is value-initialized and real records always carry a non-zero
+  // tid. Slide the valid records together so the output stays a dense array of fixed-size
+  // records, which is what the trace file format (and GetVisitedMethods) expects.
+  const size_t record_size = GetRecordSize(clock_source_);
+  uint8_t* base = buf_.get() + kTraceHeaderLength;
+  uint8_t* end = buf_.get() + end_offset;
+  uint8_t* dest = base;
+  for (uint8_t* src = base; src + record_size <= end; src += record_size) {
+    uint16_t tid = src[0] | (src[1] << 8);
+    if (tid == 0) {
+      continue;  // Unused tail of some thread's chunk.
+    }
+    if (dest != src) {
+      memcpy(dest, src, record_size);
+    }
+    dest += record_size;
+  }
+  return dest - buf_.get();
+}
+
 void Trace::FinishTracing() {
   // Compute elapsed time.
   uint64_t elapsed = MicroTime() - start_time_;
 
-  size_t final_offset = cur_offset_.LoadRelaxed();
+  // All threads are suspended at this point, so no records are being written: squeeze out the
+  // unused chunk tails before sizing the output.
+  size_t final_offset = SquashRecords(cur_offset_.LoadRelaxed());
 
-  std::set<mirror::ArtMethod*> visited_methods;
+  std::unordered_set<mirror::ArtMethod*> visited_methods;
   GetVisitedMethods(final_offset, &visited_methods);
 
   std::ostringstream os;
@@ -641,17 +685,28 @@ void Trace::ReadClocks(Thread* thread, uint32_t* thread_clock_diff, uint32_t* wa
 void Trace::LogMethodTraceEvent(Thread* thread, mirror::ArtMethod* method,
                                 instrumentation::Instrumentation::InstrumentationEvent event,
                                 uint32_t thread_clock_diff, uint32_t wall_clock_diff) {
-  // Advance cur_offset_ atomically.
-  int32_t new_offset;
-  int32_t old_offset;
-  do {
-    old_offset = cur_offset_.LoadRelaxed();
-    new_offset = old_offset + GetRecordSize(clock_source_);
-    if (new_offset > buffer_size_) {
-      overflow_ = true;
-      return;
-    }
-  } while (!cur_offset_.CompareExchangeWeakSequentiallyConsistent(old_offset, new_offset));
+  // Carve the record out of the thread's chunk of the buffer. The common case writes with no
+  // shared state at all; only a chunk refill CAS-bumps cur_offset_, so tracing threads stop
+  // serializing on one contended cache line per event. In sampling mode the sampling thread is
+  // the only writer, which keeps the sampled thread's chunk fields single-writer too.
+  const size_t record_size = GetRecordSize(clock_source_);
+  uint8_t* ptr = thread->GetTraceBufferPos();
+  if (UNLIKELY(ptr == nullptr || ptr + record_size > thread->GetTraceBufferEnd())) {
+    const int32_t chunk_size = record_size * kTraceRecordsPerChunk;
+    int32_t new_offset;
+    int32_t old_offset;
+    do {
+      old_offset = cur_offset_.LoadRelaxed();
+      new_offset = old_offset + chunk_size;
+      if (new_offset > buffer_size_) {
+        overflow_ = true;
+        return;
+      }
+    } while (!cur_offset_.CompareExchangeWeakSequentiallyConsistent(old_offset, new_offset));
+    ptr = buf_.get() + old_offset;
+    thread->SetTraceBuffer(ptr, ptr + chunk_size);
+  }
+  thread->SetTraceBufferPos(ptr + record_size);
 
   TraceAction action = kTraceMethodEnter;
   switch (event) {
@@ -671,7 +726,6 @@ void Trace::LogMethodTraceEvent(Thread* thread, mirror::ArtMethod* method,
   uint32_t method_value = EncodeTraceMethodAndAction(method, action);
 
   // Write data
-  uint8_t* ptr = buf_.get() + old_offset;
   Append2LE(ptr, thread->GetTid());
   Append4LE(ptr + 2, method_value);
   ptr += 6;
@@ -686,7 +740,7 @@ void Trace::LogMethodTraceEvent(Thread* thread, mirror::ArtMethod* method,
 }
 
 void Trace::GetVisitedMethods(size_t buf_size,
-                              std::set<mirror::ArtMethod*>* visited_methods) {
+                              std::unordered_set<mirror::ArtMethod*>* visited_methods) {
   uint8_t* ptr = buf_.get() + kTraceHeaderLength;
   uint8_t* end = buf_.get() + buf_size;
 
@@ -698,7 +752,8 @@ void Trace::GetVisitedMethods(size_t buf_size,
   }
 }
 
-void Trace::DumpMethodList(std::ostream& os, const std::set<mirror::ArtMethod*>& visited_methods) {
+void Trace::DumpMethodList(std::ostream& os,
+                           const std::unordered_set<mirror::ArtMethod*>& visited_methods) {
   for (const auto& method : visited_methods) {
     os << StringPrintf("%p\t%s\t%s\t%s\t%s\n", method,
         PrettyDescriptor(method->GetDeclaringClassDescriptor()).c_str(), method->GetName(),
@@ -19,7 +19,7 @@
 
 #include <memory>
 #include <ostream>
-#include <set>
+#include <unordered_set>
 #include <string>
 #include <vector>
 
@@ -121,9 +121,17 @@ class Trace FINAL : public instrumentation::InstrumentationListener {
                            instrumentation::Instrumentation::InstrumentationEvent event,
                            uint32_t thread_clock_diff, uint32_t wall_clock_diff);
 
+  // Squeeze the unused tails of per-thread chunks out of buf_ and return the new end offset.
+  // Requires all threads to be suspended so no records are concurrently written.
+  size_t SquashRecords(size_t end_offset);
+
   // Methods to output traced methods and threads.
-  void GetVisitedMethods(size_t end_offset, std::set<mirror::ArtMethod*>* visited_methods);
-  void DumpMethodList(std::ostream& os, const std::set<mirror::ArtMethod*>& visited_methods)
+  // Collects the distinct methods referenced by the records in buf_. A trace can easily hold
+  // millions of records over a few thousand methods, so this is a hash set keyed on the method
+  // pointer; the output format does not care about the order of the method list.
+  void GetVisitedMethods(size_t end_offset,
+                         std::unordered_set<mirror::ArtMethod*>* visited_methods);
+  void DumpMethodList(std::ostream& os, const std::unordered_set<mirror::ArtMethod*>& visited_methods)
       SHARED_LOCKS_REQUIRED(Locks::mutator_lock_);
   void DumpThreadList(std::ostream& os) LOCKS_EXCLUDED(Locks::thread_list_lock_);
 
@@ -162,7 +170,8 @@ class Trace FINAL : public instrumentation::InstrumentationListener {
   // Clock overhead.
   const uint32_t clock_overhead_ns_;
 
-  // Offset into buf_.
+  // Offset into buf_ of the next per-thread chunk to hand out. Threads write trace records into
+  // their own chunk without synchronization; only chunk refills touch this shared counter.
   AtomicInteger cur_offset_;
 
   // Did we overflow the buffer recording traces?
@@ -36,6 +36,14 @@ class String;
 }
 class InternTable;
 
+// Rollback is logged per write rather than snapshotted per page, and that is load-bearing, not
+// just simple: an aborted <clinit> must be undone while everything else that happened meanwhile
+// stays - GC may run during the transaction and move objects, update bitmaps and accounting,
+// none of which may be rewound. Wholesale mprotect/copy-on-write page restore would resurrect
+// stale object headers and pointers the collector has since rewritten, and it cannot cover the
+// intern table at all, whose rollback is a semantic remove from a native-side container, not a
+// byte-level undo. If dex2oat RSS during --image-classes initialization is the concern, the
+// logs' SafeMap nodes are the thing to slim, not the logging itself.
 class Transaction {
  public:
   Transaction();
@@ -16,6 +16,8 @@
 
 #include "utf.h"
 
+#include <string.h>
+
 #include "base/logging.h"
 #include "mirror/array.h"
 #include "mirror/object-inl.h"
@@ -24,6 +26,12 @@
 namespace art {
 
 size_t CountModifiedUtf8Chars(const char* utf8) {
+  size_t byte_count;
+  return CountModifiedUtf8Chars(utf8, &byte_count);
+}
+
+size_t CountModifiedUtf8Chars(const char* utf8, size_t* utf8_length_out) {
+  const char* start = utf8;
   size_t len = 0;
   int ic;
   while ((ic = *utf8++) != '\0') {
@@ -41,18 +49,52 @@ size_t CountModifiedUtf8Chars(const char* utf8) {
     // three-byte encoding
     utf8++;
   }
+  // The loop above advanced one past the terminating NUL.
+  *utf8_length_out = static_cast<size_t>(utf8 - start) - 1;
   return len;
 }
 
 void ConvertModifiedUtf8ToUtf16(uint16_t* utf16_data_out, const char* utf8_data_in) {
-  while (*utf8_data_in != '\0') {
-    *utf16_data_out++ = GetUtf16FromUtf8(&utf8_data_in);
+  uint8_t ch;
+  while ((ch = static_cast<uint8_t>(*utf8_data_in)) != '\0') {
+    if (LIKELY(ch < 0x80)) {
+      // One-byte encoding: widen in place instead of going through the generic decoder, which
+      // re-reads the byte through a pointer it must also advance. ASCII dominates real inputs.
+      *utf16_data_out++ = ch;
+      utf8_data_in++;
+    } else {
+      *utf16_data_out++ = GetUtf16FromUtf8(&utf8_data_in);
+    }
   }
 }
 
 void ConvertUtf16ToModifiedUtf8(char* utf8_out, const uint16_t* utf16_in, size_t char_count) {
-  while (char_count--) {
+  // ASCII run fast path: check four characters per iteration and narrow them together. The input
+  // length is known here, so unlike the NUL-terminated scans above we can safely read ahead.
+  static constexpr uint64_t kOnePerLane = 0x0001000100010001;
+  static constexpr uint64_t kNonAsciiPerLane = 0xff80ff80ff80ff80;
+  while (char_count != 0) {
+    while (char_count >= 4) {
+      uint64_t lanes;
+      memcpy(&lanes, utf16_in, sizeof(lanes));
+      // All four lanes are in [0x01, 0x7f] iff no lane has bits above 0x7f and the per-lane
+      // subtraction of one does not borrow into a high bit (i.e. no lane is zero).
+      if (((lanes | (lanes - kOnePerLane)) & kNonAsciiPerLane) != 0) {
+        break;
+      }
+      utf8_out[0] = static_cast<char>(utf16_in[0]);
+      utf8_out[1] = static_cast<char>(utf16_in[1]);
+      utf8_out[2] = static_cast<char>(utf16_in[2]);
+      utf8_out[3] = static_cast<char>(utf16_in[3]);
+      utf8_out += 4;
+      utf16_in += 4;
+      char_count -= 4;
+    }
+    if (char_count == 0) {
+      break;
+    }
     uint16_t ch = *utf16_in++;
+    char_count--;
     if (ch > 0 && ch <= 0x7f) {
       *utf8_out++ = ch;
     } else {
@@ -70,15 +112,23 @@ void ConvertUtf16ToModifiedUtf8(char* utf8_out, const uint16_t* utf16_in, size_t
 
 int32_t ComputeUtf16Hash(mirror::CharArray* chars, int32_t offset,
                          size_t char_count) {
-  int32_t hash = 0;
-  for (size_t i = 0; i < char_count; i++) {
-    hash = hash * 31 + chars->Get(offset + i);
-  }
-  return hash;
+  return ComputeUtf16Hash(chars->GetData() + offset, char_count);
 }
 
 int32_t ComputeUtf16Hash(const uint16_t* chars, size_t char_count) {
   int32_t hash = 0;
+  // Process four characters at a time. The naive loop carries a multiply-add dependency from one
+  // character to the next; folding four steps into one multiply by 31^4 plus independent partial
+  // products lets the partial products execute in parallel.
+  while (char_count >= 4) {
+    hash = hash * (31 * 31 * 31 * 31)
+        + chars[0] * (31 * 31 * 31)
+        + chars[1] * (31 * 31)
+        + chars[2] * 31
+        + chars[3];
+    chars += 4;
+    char_count -= 4;
+  }
   while (char_count--) {
     hash = hash * 31 + *chars++;
   }
@@ -41,6 +41,14 @@ namespace mirror {
  */
 size_t CountModifiedUtf8Chars(const char* utf8);
 
+/*
+ * As above, but also returns the length of the string in bytes through utf8_length_out. When the
+ * byte length equals the character count the string is pure ASCII, which lets callers widen it
+ * without decoding it again; String::AllocFromModifiedUtf8 relies on this to build a string from
+ * JNI input with a single scan.
+ */
+size_t CountModifiedUtf8Chars(const char* utf8, size_t* utf8_length_out);
+
 /*
  * Returns the number of modified UTF-8 bytes needed to represent the given
  * UTF-16 string.
@@ -272,15 +272,19 @@ std::string PrettyDescriptor(const char* descriptor) {
   }
 
   // At this point, 'c' is a string of the form "fully/qualified/Type;"
-  // or "primitive;". Rewrite the type with '.' instead of '/':
-  std::string result;
+  // or "primitive;". Copy the name up to the semicolon in one append (a push_back per character
+  // reallocates several times for typical class names), then rewrite '/' as '.' in place:
   const char* p = c;
   while (*p != ';') {
-    char ch = *p++;
-    if (ch == '/') {
-      ch = '.';
+    ++p;
+  }
+  std::string result;
+  result.reserve((p - c) + 2 * dim);
+  result.append(c, p - c);
+  for (size_t i = 0; i < result.size(); ++i) {
+    if (result[i] == '/') {
+      result[i] = '.';
     }
-    result.push_back(ch);
   }
   // ...and replace the semicolon with 'dim' "[]" pairs:
   for (size_t i = 0; i < dim; ++i) {
@@ -366,6 +370,10 @@ std::string PrettyReturnType(const char* signature) {
   return PrettyDescriptor(return_type);
 }
 
+// The Pretty* family deliberately has no result cache. These run on diagnostic paths that are
+// reached with wildly different locks held (verifier failures, class-load logging, GC logging),
+// so a shared LRU would need a lock compatible with all of them, and it would only be populated
+// in builds where verbose logging is on anyway. Keep them allocation-light instead.
 std::string PrettyMethod(mirror::ArtMethod* m, bool with_signature) {
   if (m == nullptr) {
     return "null";
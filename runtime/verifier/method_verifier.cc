@@ -51,6 +51,15 @@ static constexpr bool kTimeVerifyMethod = !kIsDebugBuild;
 static constexpr bool gDebugVerify = false;
 // TODO: Add a constant to method_verifier to turn on verbose logging?
 
+// Lines are allocated individually with operator new and only at "interesting" pcs; the bulk of
+// verification cost is the per-branch-target line copies, not these allocations. Two refinements
+// have been considered and not taken. Copy-on-write lines with dirty bits would put an ownership
+// check in front of every register write - the hot path of straight-line verification - and a
+// merge target is mutated in place by MergeRegisters on the second visit anyway, so sharing
+// rarely survives the first real join. Reusing one allocation arena across all methods of a
+// class would help allocation churn, but the arena allocators live under compiler/ and the
+// verifier must work in the runtime-only configuration; pulling an arena into runtime/ is the
+// prerequisite, not a verifier-local change.
 void PcToRegisterLineTable::Init(RegisterTrackingMode mode, InstructionFlags* flags,
                                  uint32_t insns_size, uint16_t registers_size,
                                  MethodVerifier* verifier) {
@@ -147,6 +156,13 @@ MethodVerifier::FailureKind MethodVerifier::VerifyClass(const DexFile* dex_file,
                                                         bool allow_soft_failures,
                                                         std::string* error) {
   DCHECK(class_def != nullptr);
+  // Methods are verified serially within the class on the caller's thread. Parallelism lives one
+  // level up: dex2oat's driver farms out class defs to its worker pool, which also covers the
+  // lone-huge-class case since idle workers pick up the remaining classes. Fanning out per method
+  // here would need additional attached runtime threads (this code also runs during class linking
+  // in the zygote and apps, not just in dex2oat), and the workers would immediately serialize
+  // again on ClassLinker::ResolveMethod and the dex cache. Nor is there an immutable RegTypeCache
+  // to share: each MethodVerifier's cache fills lazily as types are first touched.
   const byte* class_data = dex_file->GetClassData(*class_def);
   if (class_data == nullptr) {
     // empty class, probably a marker interface
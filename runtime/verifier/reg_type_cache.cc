@@ -218,6 +218,15 @@ RegType& RegTypeCache::FromClass(const char* descriptor, mirror::Class* klass, b
     return RegTypeFromPrimitiveType(klass->GetPrimitiveType());
   } else {
     // Look for the reference in the list of entries to have.
+    // This scan (and the one in From above) is linear by design. Primitives and small constants
+    // are already O(1) - they are process-wide statics installed once behind
+    // primitive_initialized_ and copied into the front of every cache. What is scanned here is
+    // only the reference types one method has touched, typically a few dozen entries. A hash
+    // index keyed on the class pointer would not be sound anyway: klass_ is a GcRoot that a
+    // moving collector may update whenever the verifier yields the mutator lock, silently
+    // invalidating the buckets. And the cache cannot be shared immutably across methods because
+    // entry ids are dense per-cache indices that the merge logic depends on, and the GC visits
+    // each cache's roots individually.
     for (size_t i = primitive_count_; i < entries_.size(); i++) {
       RegType* cur_entry = entries_[i];
       if (cur_entry->klass_.Read() == klass && MatchingPrecisionForClass(cur_entry, precise)) {
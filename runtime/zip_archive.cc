@@ -18,6 +18,7 @@
 
 #include <fcntl.h>
 #include <stdio.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -55,6 +56,22 @@ MemMap* ZipEntry::ExtractToMemMap(const char* zip_filename, const char* entry_fi
   std::string name(entry_filename);
   name += " extracted in memory from ";
   name += zip_filename;
+  if (zip_entry_->method == kCompressStored) {
+    // The entry is stored uncompressed; map it straight out of the archive instead of copying
+    // it into anonymous memory. MAP_PRIVATE keeps any later writes copy-on-write, so the pages
+    // stay clean and file-backed (and evictable) until actually dirtied. MapFile copes with the
+    // entry not starting page-aligned in the zip. We forgo the CRC check the inflate path gets
+    // as a side effect; corruption is still caught by the dex verifier downstream.
+    std::unique_ptr<MemMap> map(MemMap::MapFile(GetUncompressedLength(),
+                                                PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                                                GetFileDescriptor(handle_),
+                                                static_cast<off_t>(zip_entry_->offset),
+                                                name.c_str(), error_msg));
+    if (map.get() == nullptr) {
+      DCHECK(!error_msg->empty());
+    }
+    return map.release();
+  }
   std::unique_ptr<MemMap> map(MemMap::MapAnonymous(name.c_str(),
                                                    NULL, GetUncompressedLength(),
                                                    PROT_READ | PROT_WRITE, false, error_msg));
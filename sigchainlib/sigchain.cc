@@ -133,6 +133,13 @@ extern "C" void UnclaimSignalChain(int signal) {
 }
 
 // Invoke the user's signal handler.
+//
+// Cold by construction: the kernel delivers SIGSEGV straight to art_fault_handler (the runtime
+// claims the chain and installs itself with the real sigaction), so implicit null-check faults
+// are recognized and fixed up entirely inside FaultManager::HandleFault without ever reaching
+// this function. We only get here for signals ART could not handle -- genuine crashes and
+// user-installed handlers -- so the array lookup and flag branches below are not worth
+// restructuring into anything cleverer.
 extern "C" void InvokeUserSignalHandler(int sig, siginfo_t* info, void* context) {
   // Check the arguments.
   CheckSignalValid(sig);